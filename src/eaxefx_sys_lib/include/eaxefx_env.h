@@ -30,6 +30,7 @@ OR OTHER DEALINGS IN THE SOFTWARE.
 
 
 #include "eaxefx_fs_path.h"
+#include "eaxefx_string.h"
 
 
 namespace eaxefx::env
@@ -56,6 +57,15 @@ fs::Path get_special_folder(
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 
 
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Returns an empty string if the variable is not defined.
+String get_variable(
+	const char* name);
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
 } // eaxefx::env
 
 
@@ -48,6 +48,8 @@ public:
 
 	virtual void lock() = 0;
 
+	virtual bool try_lock() = 0;
+
 	virtual void unlock() = 0;
 
 	virtual void* native_handle() noexcept = 0;
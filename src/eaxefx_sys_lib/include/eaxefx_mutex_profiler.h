@@ -0,0 +1,204 @@
+/*
+
+EAX OpenAL Extension
+
+Copyright (c) 2020-2021 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+
+#ifndef EAXEFX_MUTEX_PROFILER_INCLUDED
+#define EAXEFX_MUTEX_PROFILER_INCLUDED
+
+
+#include <cstdint>
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "eaxefx_logger.h"
+#include "eaxefx_mutex.h"
+
+
+namespace eaxefx
+{
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+struct MutexProfilerHolderSnapshot
+{
+	const char* symbol_name{};
+	std::uint64_t contended_count{};
+	std::uint64_t total_wait_ns{};
+	std::uint64_t max_wait_ns{};
+}; // MutexProfilerHolderSnapshot
+
+using MutexProfilerHolderSnapshots = std::vector<MutexProfilerHolderSnapshot>;
+
+
+struct MutexProfilerEntrySnapshot
+{
+	const char* mutex_name{};
+	std::uint64_t acquisition_count{};
+	std::uint64_t contended_count{};
+	std::uint64_t total_wait_ns{};
+	std::uint64_t max_wait_ns{};
+	MutexProfilerHolderSnapshots holders{};
+}; // MutexProfilerEntrySnapshot
+
+using MutexProfilerSnapshot = std::vector<MutexProfilerEntrySnapshot>;
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+struct MutexProfilerHolderEntry
+{
+	std::atomic<const char*> symbol_name{};
+	std::atomic<std::uint64_t> contended_count{};
+	std::atomic<std::uint64_t> total_wait_ns{};
+	std::atomic<std::uint64_t> max_wait_ns{};
+}; // MutexProfilerHolderEntry
+
+
+struct MutexProfilerEntry
+{
+	static constexpr auto max_holders = 128;
+
+	using Holders = std::array<MutexProfilerHolderEntry, max_holders>;
+
+
+	std::atomic<const char*> mutex_name{};
+	std::atomic<std::uint64_t> acquisition_count{};
+	std::atomic<std::uint64_t> contended_count{};
+	std::atomic<std::uint64_t> total_wait_ns{};
+	std::atomic<std::uint64_t> max_wait_ns{};
+	Holders holders{};
+}; // MutexProfilerEntry
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Lock contention statistics.
+//
+// Disabled by default. Set environment variable EAXEFX_LOCK_STATS to "1" to enable.
+//
+// Mutexes are grouped by name (i.e., all contexts share one entry).
+// A contended wait is attributed to the symbol which held the mutex at the moment
+// (see MutexProfilerScope).
+//
+class MutexProfiler
+{
+public:
+	static constexpr auto max_entries = 16;
+	static constexpr auto max_logged_holders = 8;
+
+
+	bool is_enabled() noexcept;
+
+	// Returns a plain mutex if profiling is disabled.
+	MutexUPtr make_mutex(
+		const char* name);
+
+	MutexProfilerSnapshot make_snapshot() const;
+
+	void reset() noexcept;
+
+	void log(
+		Logger& logger) noexcept;
+
+
+	// Returns null when out of free entries.
+	MutexProfilerEntry* find_or_add_entry(
+		const char* mutex_name) noexcept;
+
+	void add_contended_wait(
+		MutexProfilerEntry& entry,
+		const char* holder_symbol_name,
+		std::uint64_t wait_ns) noexcept;
+
+
+private:
+	enum class State
+	{
+		none,
+		disabled,
+		enabled,
+	}; // State
+
+	using Entries = std::array<MutexProfilerEntry, max_entries>;
+
+
+	std::atomic<State> state_{};
+	Entries entries_{};
+}; // MutexProfiler
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Names the code which the current thread is executing (i.e., AlAlSymbolsNames::alSourcef).
+// The name must be a constant with static storage duration.
+class MutexProfilerScope
+{
+public:
+	explicit MutexProfilerScope(
+		const char* symbol_name) noexcept;
+
+	MutexProfilerScope(
+		const MutexProfilerScope& rhs) = delete;
+
+	MutexProfilerScope& operator=(
+		const MutexProfilerScope& rhs) = delete;
+
+	~MutexProfilerScope();
+
+
+	static const char* get_symbol_name() noexcept;
+
+
+private:
+	static thread_local const char* symbol_name_;
+
+
+	const char* previous_symbol_name_{};
+}; // MutexProfilerScope
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+extern MutexProfiler g_mutex_profiler;
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+} // eaxefx
+
+
+#endif // !EAXEFX_MUTEX_PROFILER_INCLUDED
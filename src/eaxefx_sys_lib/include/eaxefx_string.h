@@ -687,6 +687,12 @@ String to_string(
 String to_string(
 	unsigned long value);
 
+String to_string(
+	long long value);
+
+String to_string(
+	unsigned long long value);
+
 String to_string(
 	float value);
 
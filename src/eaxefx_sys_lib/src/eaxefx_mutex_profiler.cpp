@@ -0,0 +1,511 @@
+/*
+
+EAX OpenAL Extension
+
+Copyright (c) 2020-2021 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+
+#include "eaxefx_mutex_profiler.h"
+
+#include <cstddef>
+
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+#include <utility>
+
+#include "eaxefx_env.h"
+#include "eaxefx_string.h"
+
+
+namespace eaxefx
+{
+
+
+namespace
+{
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+constexpr auto mutex_profiler_env_name = "EAXEFX_LOCK_STATS";
+constexpr auto mutex_profiler_unknown_symbol_name = "<unknown>";
+
+
+using MutexProfilerClock = std::chrono::steady_clock;
+
+
+std::uint64_t mutex_profiler_to_ns(
+	MutexProfilerClock::duration duration) noexcept
+{
+	const auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+
+	return duration_ns > 0 ? static_cast<std::uint64_t>(duration_ns) : 0;
+}
+
+void mutex_profiler_update_max(
+	std::atomic<std::uint64_t>& max_value,
+	std::uint64_t value) noexcept
+{
+	auto current_max_value = max_value.load(std::memory_order_relaxed);
+
+	while (value > current_max_value &&
+		!max_value.compare_exchange_weak(current_max_value, value, std::memory_order_relaxed))
+	{
+	}
+}
+
+template<
+	typename TEntry,
+	std::size_t TSize
+>
+TEntry* mutex_profiler_find_or_add(
+	std::array<TEntry, TSize>& entries,
+	std::atomic<const char*> TEntry::* key_member,
+	const char* key) noexcept
+{
+	const auto hash = (reinterpret_cast<std::uintptr_t>(key) >> 2) * std::uintptr_t{2'654'435'761U};
+	auto index = static_cast<std::size_t>(hash % TSize);
+
+	for (auto i = std::size_t{}; i < TSize; ++i)
+	{
+		auto& entry = entries[index];
+		auto& entry_key = entry.*key_member;
+		auto entry_key_value = entry_key.load(std::memory_order_acquire);
+
+		if (!entry_key_value)
+		{
+			if (entry_key.compare_exchange_strong(entry_key_value, key, std::memory_order_acq_rel))
+			{
+				return &entry;
+			}
+		}
+
+		if (entry_key_value == key)
+		{
+			return &entry;
+		}
+
+		index = (index + 1) % TSize;
+	}
+
+	return nullptr;
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+class ProfiledMutex final :
+	public Mutex
+{
+public:
+	ProfiledMutex(
+		MutexUPtr mutex,
+		MutexProfiler& profiler,
+		MutexProfilerEntry& entry) noexcept;
+
+
+	// ======================================================================
+	// Mutex
+
+	void lock() override;
+
+	bool try_lock() override;
+
+	void unlock() override;
+
+	void* native_handle() noexcept override;
+
+	// Mutex
+	// ======================================================================
+
+
+private:
+	MutexUPtr mutex_;
+	MutexProfiler& profiler_;
+	MutexProfilerEntry& entry_;
+
+	// Written by the owner only.
+	// Read by the threads waiting for the mutex.
+	std::atomic<const char*> holder_symbol_name_{};
+
+	// Critical sections are recursive.
+	int lock_depth_{};
+
+
+	void on_acquired() noexcept;
+}; // ProfiledMutex
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+ProfiledMutex::ProfiledMutex(
+	MutexUPtr mutex,
+	MutexProfiler& profiler,
+	MutexProfilerEntry& entry) noexcept
+	:
+	mutex_{std::move(mutex)},
+	profiler_{profiler},
+	entry_{entry}
+{
+}
+
+void ProfiledMutex::lock()
+{
+	if (mutex_->try_lock())
+	{
+		on_acquired();
+		return;
+	}
+
+	const auto holder_symbol_name = holder_symbol_name_.load(std::memory_order_relaxed);
+	const auto begin_time = MutexProfilerClock::now();
+
+	mutex_->lock();
+
+	const auto wait_ns = mutex_profiler_to_ns(MutexProfilerClock::now() - begin_time);
+
+	on_acquired();
+
+	profiler_.add_contended_wait(
+		entry_,
+		holder_symbol_name ? holder_symbol_name : mutex_profiler_unknown_symbol_name,
+		wait_ns
+	);
+}
+
+bool ProfiledMutex::try_lock()
+{
+	if (!mutex_->try_lock())
+	{
+		return false;
+	}
+
+	on_acquired();
+
+	return true;
+}
+
+void ProfiledMutex::unlock()
+{
+	lock_depth_ -= 1;
+
+	if (lock_depth_ == 0)
+	{
+		holder_symbol_name_.store(nullptr, std::memory_order_relaxed);
+	}
+
+	mutex_->unlock();
+}
+
+void* ProfiledMutex::native_handle() noexcept
+{
+	return mutex_->native_handle();
+}
+
+void ProfiledMutex::on_acquired() noexcept
+{
+	entry_.acquisition_count.fetch_add(1, std::memory_order_relaxed);
+
+	if (lock_depth_ == 0)
+	{
+		holder_symbol_name_.store(MutexProfilerScope::get_symbol_name(), std::memory_order_relaxed);
+	}
+
+	lock_depth_ += 1;
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+} // namespace
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+bool MutexProfiler::is_enabled() noexcept
+{
+	const auto state = state_.load(std::memory_order_relaxed);
+
+	if (state != State::none)
+	{
+		return state == State::enabled;
+	}
+
+	auto is_enabled = false;
+
+	try
+	{
+		const auto env_value = env::get_variable(mutex_profiler_env_name);
+		is_enabled = (std::string_view{env_value.c_str()} == "1");
+	}
+	catch (...)
+	{
+	}
+
+	state_.store(is_enabled ? State::enabled : State::disabled, std::memory_order_relaxed);
+
+	return is_enabled;
+}
+
+MutexUPtr MutexProfiler::make_mutex(
+	const char* name)
+{
+	auto mutex = eaxefx::make_mutex();
+
+	if (!name || !is_enabled())
+	{
+		return mutex;
+	}
+
+	const auto entry = find_or_add_entry(name);
+
+	if (!entry)
+	{
+		return mutex;
+	}
+
+	return std::make_unique<ProfiledMutex>(std::move(mutex), *this, *entry);
+}
+
+MutexProfilerSnapshot MutexProfiler::make_snapshot() const
+{
+	auto snapshot = MutexProfilerSnapshot{};
+	snapshot.reserve(max_entries);
+
+	for (const auto& entry : entries_)
+	{
+		const auto mutex_name = entry.mutex_name.load(std::memory_order_acquire);
+
+		if (!mutex_name)
+		{
+			continue;
+		}
+
+		auto entry_snapshot = MutexProfilerEntrySnapshot{};
+		entry_snapshot.mutex_name = mutex_name;
+		entry_snapshot.acquisition_count = entry.acquisition_count.load(std::memory_order_relaxed);
+		entry_snapshot.contended_count = entry.contended_count.load(std::memory_order_relaxed);
+		entry_snapshot.total_wait_ns = entry.total_wait_ns.load(std::memory_order_relaxed);
+		entry_snapshot.max_wait_ns = entry.max_wait_ns.load(std::memory_order_relaxed);
+
+		for (const auto& holder : entry.holders)
+		{
+			const auto symbol_name = holder.symbol_name.load(std::memory_order_acquire);
+
+			if (!symbol_name)
+			{
+				continue;
+			}
+
+			auto holder_snapshot = MutexProfilerHolderSnapshot{};
+			holder_snapshot.symbol_name = symbol_name;
+			holder_snapshot.contended_count = holder.contended_count.load(std::memory_order_relaxed);
+			holder_snapshot.total_wait_ns = holder.total_wait_ns.load(std::memory_order_relaxed);
+			holder_snapshot.max_wait_ns = holder.max_wait_ns.load(std::memory_order_relaxed);
+
+			if (holder_snapshot.contended_count == 0)
+			{
+				continue;
+			}
+
+			entry_snapshot.holders.emplace_back(holder_snapshot);
+		}
+
+		std::sort(
+			entry_snapshot.holders.begin(),
+			entry_snapshot.holders.end(),
+			[](
+				const MutexProfilerHolderSnapshot& lhs,
+				const MutexProfilerHolderSnapshot& rhs)
+			{
+				return lhs.total_wait_ns > rhs.total_wait_ns;
+			}
+		);
+
+		snapshot.emplace_back(std::move(entry_snapshot));
+	}
+
+	std::sort(
+		snapshot.begin(),
+		snapshot.end(),
+		[](
+			const MutexProfilerEntrySnapshot& lhs,
+			const MutexProfilerEntrySnapshot& rhs)
+		{
+			return lhs.total_wait_ns > rhs.total_wait_ns;
+		}
+	);
+
+	return snapshot;
+}
+
+void MutexProfiler::reset() noexcept
+{
+	for (auto& entry : entries_)
+	{
+		entry.acquisition_count.store(0, std::memory_order_relaxed);
+		entry.contended_count.store(0, std::memory_order_relaxed);
+		entry.total_wait_ns.store(0, std::memory_order_relaxed);
+		entry.max_wait_ns.store(0, std::memory_order_relaxed);
+
+		for (auto& holder : entry.holders)
+		{
+			holder.contended_count.store(0, std::memory_order_relaxed);
+			holder.total_wait_ns.store(0, std::memory_order_relaxed);
+			holder.max_wait_ns.store(0, std::memory_order_relaxed);
+		}
+	}
+}
+
+void MutexProfiler::log(
+	Logger& logger) noexcept
+try
+{
+	if (!is_enabled())
+	{
+		return;
+	}
+
+	const auto snapshot = make_snapshot();
+
+	logger.info("");
+	logger.info("Lock statistics (time in nanoseconds; \"holder\" is the symbol the waiters were blocked by):");
+
+	auto string = String{};
+
+	for (const auto& entry : snapshot)
+	{
+		string.clear();
+		string += "  ";
+		string += entry.mutex_name;
+		string += ": acquisitions ";
+		string += to_string(static_cast<unsigned long long>(entry.acquisition_count));
+		string += ", contended ";
+		string += to_string(static_cast<unsigned long long>(entry.contended_count));
+		string += ", total wait ";
+		string += to_string(static_cast<unsigned long long>(entry.total_wait_ns));
+		string += ", max wait ";
+		string += to_string(static_cast<unsigned long long>(entry.max_wait_ns));
+		logger.info(string.c_str());
+
+		const auto holder_count = std::min(static_cast<int>(entry.holders.size()), max_logged_holders);
+
+		for (auto i = 0; i < holder_count; ++i)
+		{
+			const auto& holder = entry.holders[i];
+
+			string.clear();
+			string += "    holder ";
+			string += holder.symbol_name;
+			string += ": contended ";
+			string += to_string(static_cast<unsigned long long>(holder.contended_count));
+			string += ", total wait ";
+			string += to_string(static_cast<unsigned long long>(holder.total_wait_ns));
+			string += ", max wait ";
+			string += to_string(static_cast<unsigned long long>(holder.max_wait_ns));
+			logger.info(string.c_str());
+		}
+	}
+}
+catch (...)
+{
+}
+
+MutexProfilerEntry* MutexProfiler::find_or_add_entry(
+	const char* mutex_name) noexcept
+{
+	if (!mutex_name)
+	{
+		return nullptr;
+	}
+
+	return mutex_profiler_find_or_add(entries_, &MutexProfilerEntry::mutex_name, mutex_name);
+}
+
+void MutexProfiler::add_contended_wait(
+	MutexProfilerEntry& entry,
+	const char* holder_symbol_name,
+	std::uint64_t wait_ns) noexcept
+{
+	entry.contended_count.fetch_add(1, std::memory_order_relaxed);
+	entry.total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+	mutex_profiler_update_max(entry.max_wait_ns, wait_ns);
+
+	const auto holder = mutex_profiler_find_or_add(
+		entry.holders,
+		&MutexProfilerHolderEntry::symbol_name,
+		holder_symbol_name
+	);
+
+	if (!holder)
+	{
+		return;
+	}
+
+	holder->contended_count.fetch_add(1, std::memory_order_relaxed);
+	holder->total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+	mutex_profiler_update_max(holder->max_wait_ns, wait_ns);
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+thread_local const char* MutexProfilerScope::symbol_name_{};
+
+
+MutexProfilerScope::MutexProfilerScope(
+	const char* symbol_name) noexcept
+	:
+	previous_symbol_name_{symbol_name_}
+{
+	symbol_name_ = symbol_name;
+}
+
+MutexProfilerScope::~MutexProfilerScope()
+{
+	symbol_name_ = previous_symbol_name_;
+}
+
+const char* MutexProfilerScope::get_symbol_name() noexcept
+{
+	return symbol_name_;
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+MutexProfiler g_mutex_profiler{};
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+} // eaxefx
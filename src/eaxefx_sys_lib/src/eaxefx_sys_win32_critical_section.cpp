@@ -49,6 +49,11 @@ void SysWin32CriticalSection::lock()
 	EnterCriticalSection(&critical_section_);
 }
 
+bool SysWin32CriticalSection::try_lock()
+{
+	return TryEnterCriticalSection(&critical_section_) != FALSE;
+}
+
 void SysWin32CriticalSection::unlock()
 {
 	LeaveCriticalSection(&critical_section_);
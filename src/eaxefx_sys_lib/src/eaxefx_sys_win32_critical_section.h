@@ -54,6 +54,8 @@ public:
 
 	void lock();
 
+	bool try_lock();
+
 	void unlock();
 
 
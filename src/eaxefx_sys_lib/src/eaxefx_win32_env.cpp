@@ -92,6 +92,43 @@ fs::Path get_special_folder(
 	return fs::Path{u8_buffer.c_str(), static_cast<Int>(u8_buffer.size())};
 }
 
+String get_variable(
+	const char* name)
+{
+	if (!name || name[0] == '\0')
+	{
+		throw EnvException{"Null or empty variable name."};
+	}
+
+	const auto u16_name = encoding::to_utf16(name);
+	const auto win32_name = reinterpret_cast<LPCWSTR>(u16_name.c_str());
+
+	const auto win32_size_with_nul = GetEnvironmentVariableW(win32_name, nullptr, 0);
+
+	if (win32_size_with_nul == 0)
+	{
+		return String{};
+	}
+
+	auto u16_value = U16String{};
+	u16_value.resize(win32_size_with_nul - 1);
+
+	const auto win32_size = GetEnvironmentVariableW(
+		win32_name,
+		reinterpret_cast<LPWSTR>(u16_value.data()),
+		win32_size_with_nul
+	);
+
+	if (win32_size == 0 || win32_size >= win32_size_with_nul)
+	{
+		return String{};
+	}
+
+	u16_value.resize(win32_size);
+
+	return encoding::to_utf8(u16_value.c_str());
+}
+
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 
 
@@ -46,6 +46,8 @@ public:
 
 	void lock() override;
 
+	bool try_lock() override;
+
 	void unlock() override;
 
 	void* native_handle() noexcept override;
@@ -68,6 +70,11 @@ void Win32Mutex::lock()
 	win32_critical_section_.lock();
 }
 
+bool Win32Mutex::try_lock()
+{
+	return win32_critical_section_.try_lock();
+}
+
 void Win32Mutex::unlock()
 {
 	win32_critical_section_.unlock();
@@ -77,6 +77,10 @@ constexpr int to_string_max_length() noexcept
 	{
 		return 10;
 	}
+	else if constexpr (std::is_same_v<T, long long> || std::is_same_v<T, unsigned long long>)
+	{
+		return 20;
+	}
 	else if constexpr (std::is_same_v<T, float>)
 	{
 		return 16;
@@ -195,6 +199,26 @@ String to_string(
 	return to_string(static_cast<unsigned int>(value));
 }
 
+String to_string(
+	long long value)
+{
+	static_assert(sizeof(decltype(value)) == 8);
+
+	auto string = String{};
+	to_string_generic(value, "%lld", string);
+	return string;
+}
+
+String to_string(
+	unsigned long long value)
+{
+	static_assert(sizeof(decltype(value)) == 8);
+
+	auto string = String{};
+	to_string_generic(value, "%llu", string);
+	return string;
+}
+
 String to_string(
 	float value)
 {
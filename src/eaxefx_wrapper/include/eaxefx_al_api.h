@@ -40,6 +40,17 @@ namespace eaxefx
 {
 
 
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+struct AlApiLockedContext
+{
+	MoveableMutexLock mutex_lock{};
+	AlApiContext* context{};
+}; // AlApiLockedContext
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 class AlApi
@@ -66,6 +77,10 @@ public:
 
 	virtual AlApiContext& get_current_context() = 0;
 
+	// Locks the current context with its own lock.
+	// The global lock is held only while looking up the context.
+	virtual AlApiLockedContext lock_current_context() = 0;
+
 	virtual ALboolean AL_APIENTRY eax_set_buffer_mode(
 		ALsizei n,
 		const ALuint* buffers,
@@ -74,6 +89,11 @@ public:
 	virtual ALenum AL_APIENTRY eax_get_buffer_mode(
 		ALuint buffer,
 		ALint* pReserved) = 0;
+
+	virtual ALCboolean ALC_APIENTRY alc_set_thread_context(
+		ALCcontext* context) = 0;
+
+	virtual ALCcontext* ALC_APIENTRY alc_get_thread_context() = 0;
 }; // AlApi
 
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -29,6 +29,7 @@ OR OTHER DEALINGS IN THE SOFTWARE.
 
 
 #include "AL/alc.h"
+#include "AL/alext.h"
 
 #include <memory>
 #include <string_view>
@@ -37,6 +38,7 @@ OR OTHER DEALINGS IN THE SOFTWARE.
 #include "eaxefx_al_symbols.h"
 #include "eaxefx_eaxx.h"
 #include "eaxefx_logger.h"
+#include "eaxefx_moveable_mutex_lock.h"
 #include "eaxefx_mutex.h"
 #include "eaxefx_span.h"
 
@@ -71,6 +73,9 @@ public:
 
 	virtual void alc_make_current() = 0;
 
+	virtual void alc_make_thread_current(
+		PFNALCSETTHREADCONTEXTPROC alc_set_thread_context) = 0;
+
 	virtual void alc_destroy() = 0;
 
 	virtual void* al_get_proc_address(
@@ -92,6 +97,8 @@ public:
 	virtual ALCcontext* get_al_context() const noexcept = 0;
 
 	virtual Eaxx& get_eaxx() = 0;
+
+	virtual MoveableMutexLock get_lock() = 0;
 }; // AlApiContext
 
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
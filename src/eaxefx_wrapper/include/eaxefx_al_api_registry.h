@@ -0,0 +1,264 @@
+/*
+
+EAX OpenAL Extension
+
+Copyright (c) 2020-2021 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+
+#ifndef EAXEFX_AL_API_REGISTRY_INCLUDED
+#define EAXEFX_AL_API_REGISTRY_INCLUDED
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace eaxefx
+{
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Flat open addressing map keyed by AL handle (i.e., ALCdevice*, ALCcontext*).
+//
+// Linear probing; removal shifts the following entries back, so there are no tombstones.
+// Pointers to values are invalidated by "add" and "remove".
+// Store a pointer to the object (i.e., std::unique_ptr) as a value to get a stable handle.
+//
+template<
+	typename TKey,
+	typename TValue
+>
+class AlApiRegistry
+{
+public:
+	static_assert(std::is_pointer_v<TKey>, "Expected a pointer key.");
+
+
+	using Key = TKey;
+	using Value = TValue;
+
+
+	AlApiRegistry() noexcept = default;
+
+	AlApiRegistry(
+		const AlApiRegistry& rhs) = delete;
+
+	AlApiRegistry& operator=(
+		const AlApiRegistry& rhs) = delete;
+
+
+	int get_size() const noexcept
+	{
+		return size_;
+	}
+
+	bool is_empty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	Value* find(
+		Key key) noexcept
+	{
+		const auto index = find_index(key);
+
+		if (index == npos)
+		{
+			return nullptr;
+		}
+
+		return &slots_[index].value;
+	}
+
+	// Returns null if the key is null or already registered.
+	Value* add(
+		Key key,
+		Value&& value)
+	{
+		if (!key || find_index(key) != npos)
+		{
+			return nullptr;
+		}
+
+		if (((size_ + 1) * 2) > static_cast<int>(slots_.size()))
+		{
+			rehash(slots_.empty() ? min_capacity : slots_.size() * 2);
+		}
+
+		auto& slot = slots_[find_free_index(key)];
+		slot.key = key;
+		slot.value = std::move(value);
+
+		size_ += 1;
+
+		return &slot.value;
+	}
+
+	bool remove(
+		Key key) noexcept
+	{
+		auto hole_index = find_index(key);
+
+		if (hole_index == npos)
+		{
+			return false;
+		}
+
+		const auto mask = slots_.size() - 1;
+
+		for (auto index = (hole_index + 1) & mask; slots_[index].key; index = (index + 1) & mask)
+		{
+			const auto home_index = get_home_index(slots_[index].key);
+
+			// Move the entry into the hole unless its home lies in (hole, index].
+			//
+			if (((index - home_index) & mask) >= ((index - hole_index) & mask))
+			{
+				slots_[hole_index] = std::move(slots_[index]);
+				hole_index = index;
+			}
+		}
+
+		slots_[hole_index] = Slot{};
+
+		size_ -= 1;
+
+		return true;
+	}
+
+	template<
+		typename TFunc
+	>
+	void for_each(
+		TFunc&& func)
+	{
+		for (auto& slot : slots_)
+		{
+			if (slot.key)
+			{
+				func(slot.key, slot.value);
+			}
+		}
+	}
+
+
+private:
+	static constexpr auto min_capacity = std::size_t{8};
+	static constexpr auto npos = ~std::size_t{};
+
+
+	struct Slot
+	{
+		Key key{};
+		Value value{};
+	}; // Slot
+
+	using Slots = std::vector<Slot>;
+
+
+	Slots slots_{};
+	int size_{};
+
+
+	std::size_t get_home_index(
+		Key key) const noexcept
+	{
+		// Fibonacci hashing; the low bits of a heap address are mostly zero.
+		//
+		const auto hash = static_cast<std::uintptr_t>(
+			(reinterpret_cast<std::uintptr_t>(key) >> 4) *
+				static_cast<std::uintptr_t>(0x9E37'79B9'7F4A'7C15ULL));
+
+		return static_cast<std::size_t>(hash ^ (hash >> 16)) & (slots_.size() - 1);
+	}
+
+	std::size_t find_index(
+		Key key) const noexcept
+	{
+		if (!key || size_ == 0)
+		{
+			return npos;
+		}
+
+		const auto mask = slots_.size() - 1;
+
+		for (auto index = get_home_index(key); ; index = (index + 1) & mask)
+		{
+			const auto slot_key = slots_[index].key;
+
+			if (!slot_key)
+			{
+				return npos;
+			}
+
+			if (slot_key == key)
+			{
+				return index;
+			}
+		}
+	}
+
+	std::size_t find_free_index(
+		Key key) const noexcept
+	{
+		const auto mask = slots_.size() - 1;
+
+		auto index = get_home_index(key);
+
+		while (slots_[index].key)
+		{
+			index = (index + 1) & mask;
+		}
+
+		return index;
+	}
+
+	void rehash(
+		std::size_t capacity)
+	{
+		auto old_slots = Slots{};
+		old_slots.resize(capacity);
+		old_slots.swap(slots_);
+
+		for (auto& old_slot : old_slots)
+		{
+			if (old_slot.key)
+			{
+				slots_[find_free_index(old_slot.key)] = std::move(old_slot);
+			}
+		}
+	}
+}; // AlApiRegistry
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+} // eaxefx
+
+
+#endif // !EAXEFX_AL_API_REGISTRY_INCLUDED
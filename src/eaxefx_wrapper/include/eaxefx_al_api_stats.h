@@ -0,0 +1,283 @@
+/*
+
+EAX OpenAL Extension
+
+Copyright (c) 2020-2021 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+
+#ifndef EAXEFX_AL_API_STATS_INCLUDED
+#define EAXEFX_AL_API_STATS_INCLUDED
+
+
+#include <cstdint>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "eaxefx_al_symbols.h"
+#include "eaxefx_logger.h"
+#include "eaxefx_mutex_profiler.h"
+
+
+namespace eaxefx
+{
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+using AlApiStatsClock = std::chrono::steady_clock;
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Bucket N counts durations in range [2^(N-1), 2^N) nanoseconds.
+// The last bucket counts everything above.
+constexpr auto al_api_stats_bucket_count = 32;
+
+using AlApiStatsBuckets = std::array<std::uint64_t, al_api_stats_bucket_count>;
+
+
+struct AlApiStatsHistogramSnapshot
+{
+	std::uint64_t count{};
+	std::uint64_t total_ns{};
+	std::uint64_t max_ns{};
+	AlApiStatsBuckets buckets{};
+}; // AlApiStatsHistogramSnapshot
+
+struct AlApiStatsEntrySnapshot
+{
+	const char* symbol_name{};
+	std::uint64_t call_count{};
+	AlApiStatsHistogramSnapshot wrapper_time{};
+	AlApiStatsHistogramSnapshot driver_time{};
+	AlApiStatsHistogramSnapshot lock_wait_time{};
+}; // AlApiStatsEntrySnapshot
+
+using AlApiStatsSnapshot = std::vector<AlApiStatsEntrySnapshot>;
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+class AlApiStatsHistogram
+{
+public:
+	void add(
+		std::uint64_t duration_ns) noexcept;
+
+	AlApiStatsHistogramSnapshot make_snapshot() const noexcept;
+
+	void reset() noexcept;
+
+
+private:
+	using Buckets = std::array<std::atomic<std::uint64_t>, al_api_stats_bucket_count>;
+
+
+	std::atomic<std::uint64_t> count_{};
+	std::atomic<std::uint64_t> total_ns_{};
+	std::atomic<std::uint64_t> max_ns_{};
+	Buckets buckets_{};
+
+
+	static int get_bucket_index(
+		std::uint64_t duration_ns) noexcept;
+}; // AlApiStatsHistogram
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+struct AlApiStatsEntry
+{
+	std::atomic<const char*> symbol_name{};
+	std::atomic<std::uint64_t> call_count{};
+	AlApiStatsHistogram wrapper_time{};
+	AlApiStatsHistogram driver_time{};
+	AlApiStatsHistogram lock_wait_time{};
+}; // AlApiStatsEntry
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Per entry point statistics.
+//
+// Disabled by default. Set environment variable EAXEFX_STATS to "1" to enable.
+// When disabled each entry point pays only for a relaxed load of a flag.
+//
+class AlApiStats
+{
+public:
+	static constexpr auto max_entries = 256;
+
+
+	void initialize(
+		Logger* logger) noexcept;
+
+	bool is_enabled() const noexcept;
+
+	// Entries are keyed by address of the name constant (i.e., AlAlSymbolsNames::alSourcef).
+	// Returns null when out of free entries.
+	AlApiStatsEntry* find_or_add_entry(
+		const char* symbol_name) noexcept;
+
+	AlApiStatsSnapshot make_snapshot() const;
+
+	void reset() noexcept;
+
+	void log() noexcept;
+
+
+	// Replaces driver symbols with thunks which measure time spent in the driver.
+	void instrument(
+		AlAlcSymbols& al_alc_symbols) noexcept;
+
+	void instrument(
+		AlAlSymbols& al_al_symbols) noexcept;
+
+	void instrument(
+		AlEfxSymbols& al_efx_symbols) noexcept;
+
+
+private:
+	using Entries = std::array<AlApiStatsEntry, max_entries>;
+
+
+	std::atomic<bool> is_enabled_{};
+	Logger* logger_{};
+	Entries entries_{};
+}; // AlApiStats
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Measures an exported function.
+// Also tells the mutex profiler which symbol holds the locks.
+class AlApiStatsScope
+{
+public:
+	explicit AlApiStatsScope(
+		const char* symbol_name) noexcept;
+
+	AlApiStatsScope(
+		const AlApiStatsScope& rhs) = delete;
+
+	AlApiStatsScope& operator=(
+		const AlApiStatsScope& rhs) = delete;
+
+	~AlApiStatsScope();
+
+
+private:
+	friend class AlApiStatsDriverScope;
+	friend class AlApiStatsLockWaitScope;
+
+
+	static thread_local AlApiStatsScope* current_;
+
+
+	MutexProfilerScope mutex_profiler_scope_;
+	AlApiStatsEntry* entry_{};
+	AlApiStatsScope* previous_{};
+	AlApiStatsClock::time_point begin_time_{};
+	bool has_driver_calls_{};
+	bool has_lock_waits_{};
+	std::uint64_t driver_ns_{};
+	std::uint64_t lock_wait_ns_{};
+}; // AlApiStatsScope
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Measures a call into the driver made within the current AlApiStatsScope.
+class AlApiStatsDriverScope
+{
+public:
+	AlApiStatsDriverScope() noexcept;
+
+	AlApiStatsDriverScope(
+		const AlApiStatsDriverScope& rhs) = delete;
+
+	AlApiStatsDriverScope& operator=(
+		const AlApiStatsDriverScope& rhs) = delete;
+
+	~AlApiStatsDriverScope();
+
+
+private:
+	AlApiStatsScope* scope_{};
+	AlApiStatsClock::time_point begin_time_{};
+}; // AlApiStatsDriverScope
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// Measures a wait for a lock within the current AlApiStatsScope.
+class AlApiStatsLockWaitScope
+{
+public:
+	AlApiStatsLockWaitScope() noexcept;
+
+	AlApiStatsLockWaitScope(
+		const AlApiStatsLockWaitScope& rhs) = delete;
+
+	AlApiStatsLockWaitScope& operator=(
+		const AlApiStatsLockWaitScope& rhs) = delete;
+
+	~AlApiStatsLockWaitScope();
+
+
+private:
+	AlApiStatsScope* scope_{};
+	AlApiStatsClock::time_point begin_time_{};
+}; // AlApiStatsLockWaitScope
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+extern AlApiStats g_al_api_stats;
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+} // eaxefx
+
+
+#endif // !EAXEFX_AL_API_STATS_INCLUDED
@@ -367,6 +367,18 @@ struct AlXRamSymbolsNames
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 
 
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// ALC_EXT_thread_local_context symbol names
+struct AlAlcThreadLocalContextSymbolsNames
+{
+	static constexpr auto alcSetThreadContext = "alcSetThreadContext";
+	static constexpr auto alcGetThreadContext = "alcGetThreadContext";
+}; // AlAlcThreadLocalContextSymbolsNames
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
 } // eaxefx
 
 
@@ -30,19 +30,23 @@ OR OTHER DEALINGS IN THE SOFTWARE.
 #include <cstddef>
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "AL/al.h"
 #include "AL/alc.h"
+#include "AL/alext.h"
 #include "AL/efx.h"
 
 #include "eaxefx_al_api_context.h"
+#include "eaxefx_al_api_registry.h"
+#include "eaxefx_al_api_stats.h"
 #include "eaxefx_al_api_utils.h"
 #include "eaxefx_al_loader.h"
 #include "eaxefx_al_symbols.h"
@@ -55,6 +59,7 @@ OR OTHER DEALINGS IN THE SOFTWARE.
 #include "eaxefx_logger.h"
 #include "eaxefx_moveable_mutex_lock.h"
 #include "eaxefx_mutex.h"
+#include "eaxefx_mutex_profiler.h"
 #include "eaxefx_shared_library.h"
 #include "eaxefx_span.h"
 #include "eaxefx_string.h"
@@ -93,7 +98,7 @@ ALboolean AL_APIENTRY EAXSetBufferMode(
 	ALint value)
 try
 {
-	const auto mutex_lock = g_al_api.get_lock();
+	const auto stats_scope = AlApiStatsScope{AlXRamSymbolsNames::EAXSetBufferMode};
 
 	return g_al_api.eax_set_buffer_mode(n, buffers, value);
 }
@@ -108,7 +113,7 @@ ALenum AL_APIENTRY EAXGetBufferMode(
 	ALint* pReserved)
 try
 {
-	const auto mutex_lock = g_al_api.get_lock();
+	const auto stats_scope = AlApiStatsScope{AlXRamSymbolsNames::EAXGetBufferMode};
 
 	return g_al_api.eax_get_buffer_mode(buffer, pReserved);
 }
@@ -121,6 +126,38 @@ catch (...)
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 
 
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+ALCboolean ALC_APIENTRY alcSetThreadContext(
+	ALCcontext* context)
+try
+{
+	const auto stats_scope = AlApiStatsScope{AlAlcThreadLocalContextSymbolsNames::alcSetThreadContext};
+
+	return g_al_api.alc_set_thread_context(context);
+}
+catch (...)
+{
+	utils::log_exception(g_al_api.get_logger(), AlAlcThreadLocalContextSymbolsNames::alcSetThreadContext);
+	return ALC_FALSE;
+}
+
+ALCcontext* ALC_APIENTRY alcGetThreadContext()
+try
+{
+	const auto stats_scope = AlApiStatsScope{AlAlcThreadLocalContextSymbolsNames::alcGetThreadContext};
+
+	return g_al_api.alc_get_thread_context();
+}
+catch (...)
+{
+	utils::log_exception(g_al_api.get_logger(), AlAlcThreadLocalContextSymbolsNames::alcGetThreadContext);
+	return nullptr;
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
 } // namespace
 
 
@@ -168,6 +205,8 @@ public:
 
 	AlApiContext& get_current_context() override;
 
+	AlApiLockedContext lock_current_context() override;
+
 	ALboolean AL_APIENTRY eax_set_buffer_mode(
 		ALsizei n,
 		const ALuint* buffers,
@@ -177,6 +216,11 @@ public:
 		ALuint buffer,
 		ALint* pReserved);
 
+	ALCboolean ALC_APIENTRY alc_set_thread_context(
+		ALCcontext* context) override;
+
+	ALCcontext* ALC_APIENTRY alc_get_thread_context() override;
+
 	Eaxx* get_eaxx() const noexcept;
 
 
@@ -606,29 +650,50 @@ private:
 
 	using BufferMap = std::unordered_map<ALuint, Buffer>;
 
-	using Contexts = std::list<AlApiContextUPtr>;
-
-
 	struct Device
 	{
+		MutexUPtr mutex{};
+
 		ALCdevice* al_device{};
 		ALsizei x_ram_free_size{};
 
 		String special_name{};
 		BufferMap buffers{};
-		Contexts contexts{};
 	}; // Device
 
-	using Devices = std::list<Device>;
+	using DeviceUPtr = std::unique_ptr<Device>;
+	using Devices = AlApiRegistry<ALCdevice*, DeviceUPtr>;
+
+
+	struct ContextEntry
+	{
+		AlApiContextUPtr context{};
+		Device* device{};
+	}; // ContextEntry
+
+	using Contexts = AlApiRegistry<ALCcontext*, ContextEntry>;
+
+
+	struct LockedDevice
+	{
+		MoveableMutexLock mutex_lock{};
+		Device* device{};
+	}; // LockedDevice
 
 
-	using InitializeFunc = MoveableMutexLock (AlApiImpl::*)();
+	enum class InitializeState
+	{
+		invalid,
+		not_initialized,
+		try_to_initialize,
+		initialized,
+	}; // InitializeState
 
 
 	using MutexLock = std::scoped_lock<Mutex>;
 
 
-	InitializeFunc initialize_func_{};
+	std::atomic<InitializeState> initialize_state_{};
 	MutexUPtr mutex_{};
 	eaxefx::NullableLogger logger_{};
 	eaxefx::SharedLibraryUPtr al_library_{};
@@ -638,7 +703,13 @@ private:
 	eaxefx::AlAlSymbolsUPtr al_al_symbols_{};
 	AlSymbolMap al_al_symbol_map_{};
 	Devices devices_{};
+	Contexts contexts_{};
 	AlApiContext* current_context_{};
+	Device* current_device_{};
+	static thread_local AlApiContext* thread_context_;
+	static thread_local Device* thread_device_;
+	PFNALCSETTHREADCONTEXTPROC alc_set_thread_context_{};
+	PFNALCGETTHREADCONTEXTPROC alc_get_thread_context_{};
 	eaxefx::EaxxUPtr eaxx_{};
 
 	String string_buffer_{};
@@ -656,6 +727,8 @@ private:
 
 	void initialize_al_symbols();
 
+	void initialize_al_thread_local_context_symbols() noexcept;
+
 
 	void initialize_al_alc_symbol_map() noexcept;
 
@@ -667,16 +740,16 @@ private:
 	void initialize_logger();
 
 
-	MoveableMutexLock initialize_invalid_state();
-
-	MoveableMutexLock initialize_not_initialized();
-
 	MoveableMutexLock initialize_lock_mutex();
 
 	MoveableMutexLock initialize_try_to_initialize();
 
 	MoveableMutexLock initialize();
 
+	// Makes sure the wrapper is initialized without holding the lock afterwards.
+	// For entry points which forward to the driver and touch no wrapper state.
+	void initialize_lock_free();
+
 
 	Device* find_device(
 		ALCdevice* al_device) noexcept;
@@ -684,23 +757,31 @@ private:
 	Device& get_device(
 		ALCdevice* al_device);
 
+	Device* find_current_device() noexcept;
+
 	Device& get_current_device();
 
+	void remove_device(
+		ALCdevice* al_device);
+
+	LockedDevice lock_current_device();
+
 	Buffer& get_buffer(
 		Device& device,
 		ALuint al_buffer_name);
 
-	Buffer& get_current_buffer(
-		ALuint al_buffer_name);
 
+	AlApiContext* find_context() noexcept;
 
 	AlApiContext& get_context();
 
-	AlApiContext& get_context(
+	ContextEntry& get_context_entry(
 		ALCcontext* al_context);
 
+	AlApiLockedContext try_lock_current_context();
+
 	void remove_context(
-		const AlApiContext& context);
+		ALCcontext* al_context);
 
 
 	void log_devices_info(
@@ -749,19 +830,22 @@ struct AlApiImpl::ErrorMessages
 
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
+thread_local AlApiContext* AlApiImpl::thread_context_{};
+thread_local AlApiImpl::Device* AlApiImpl::thread_device_{};
+
 AlApiImpl::AlApiImpl() noexcept
 {
 	try
 	{
-		mutex_ = make_mutex();
+		mutex_ = g_mutex_profiler.make_mutex("AL API");
 
 		string_buffer_.reserve(min_string_buffer_capacity);
 
-		initialize_func_ = &AlApiImpl::initialize_try_to_initialize;
+		initialize_state_.store(InitializeState::try_to_initialize, std::memory_order_release);
 	}
 	catch (...)
 	{
-		initialize_func_ = &AlApiImpl::initialize_invalid_state;
+		initialize_state_.store(InitializeState::invalid, std::memory_order_release);
 	}
 }
 
@@ -801,6 +885,8 @@ void AlApiImpl::on_thread_detach() noexcept
 void AlApiImpl::on_process_detach() noexcept
 {
 	logger_.set_immediate_mode();
+	g_al_api_stats.log();
+	g_mutex_profiler.log(logger_);
 }
 
 MoveableMutexLock AlApiImpl::get_lock()
@@ -813,6 +899,22 @@ AlApiContext& AlApiImpl::get_current_context()
 	return get_context();
 }
 
+AlApiLockedContext AlApiImpl::lock_current_context()
+{
+	// The thread's context can't be changed by other threads.
+	//
+	if (thread_context_)
+	{
+		return AlApiLockedContext{thread_context_->get_lock(), thread_context_};
+	}
+
+	const auto mt_lock = initialize();
+
+	auto& context = get_context();
+
+	return AlApiLockedContext{context.get_lock(), &context};
+}
+
 ALboolean AL_APIENTRY AlApiImpl::eax_set_buffer_mode(
 	ALsizei n,
 	const ALuint* buffers,
@@ -846,7 +948,8 @@ ALboolean AL_APIENTRY AlApiImpl::eax_set_buffer_mode(
 			fail("Unsupported X-RAM mode.");
 	}
 
-	auto& device = get_current_device();
+	const auto locked_device = lock_current_device();
+	auto& device = *locked_device.device;
 
 	for (const auto al_buffer_id : al_buffer_ids)
 	{
@@ -891,11 +994,61 @@ ALenum AL_APIENTRY AlApiImpl::eax_get_buffer_mode(
 		fail("Non-null reserved value.");
 	}
 
-	const auto& our_buffer = get_current_buffer(buffer);
+	const auto locked_device = lock_current_device();
+	const auto& our_buffer = get_buffer(*locked_device.device, buffer);
 
 	return our_buffer.x_ram_mode;
 }
 
+ALCboolean ALC_APIENTRY AlApiImpl::alc_set_thread_context(
+	ALCcontext* context)
+{
+	const auto mt_lock = initialize();
+
+	if (!alc_set_thread_context_)
+	{
+		fail("Thread local context not supported by the driver.");
+	}
+
+	if (context)
+	{
+		auto& our_context = get_context_entry(context);
+
+		{
+			const auto context_lock = our_context.context->get_lock();
+			our_context.context->alc_make_thread_current(alc_set_thread_context_);
+		}
+
+		thread_context_ = our_context.context.get();
+		thread_device_ = our_context.device;
+	}
+	else
+	{
+		const auto alc_result = alc_set_thread_context_(nullptr);
+		thread_context_ = nullptr;
+		thread_device_ = nullptr;
+
+		if (alc_result == ALC_FALSE)
+		{
+			fail("AL failed to unset thread context.");
+		}
+	}
+
+	return ALC_TRUE;
+}
+
+ALCcontext* ALC_APIENTRY AlApiImpl::alc_get_thread_context()
+{
+	initialize_lock_free();
+
+	if (!thread_context_)
+	{
+		return nullptr;
+	}
+
+	return thread_context_->get_al_context();
+}
+
 Eaxx* AlApiImpl::get_eaxx() const noexcept
 {
 	return eaxx_.get();
@@ -932,9 +1085,12 @@ try
 
 	al_api_context->alc_create_context(context_init_param);
 
-	our_device.contexts.emplace_back(std::move(al_api_context));
+	const auto al_context = al_api_context->get_al_context();
 
-	const auto al_context = our_device.contexts.back()->get_al_context();
+	if (!contexts_.add(al_context, ContextEntry{std::move(al_api_context), &our_device}))
+	{
+		fail("Context already registered.");
+	}
 
 	return al_context;
 }
@@ -961,14 +1117,25 @@ try
 
 	if (context)
 	{
-		auto& our_context = get_context(context);
-		our_context.alc_make_current();
-		current_context_ = &our_context;
+		auto& our_context = get_context_entry(context);
+
+		{
+			const auto context_lock = our_context.context->get_lock();
+			our_context.context->alc_make_current();
+		}
+
+		current_context_ = our_context.context.get();
+		current_device_ = our_context.device;
+		thread_context_ = nullptr;
+		thread_device_ = nullptr;
 	}
 	else
 	{
 		const auto alc_result = al_alc_symbols_->alcMakeContextCurrent(nullptr);
 		current_context_ = nullptr;
+		current_device_ = nullptr;
+		thread_context_ = nullptr;
+		thread_device_ = nullptr;
 
 		if (alc_result == ALC_FALSE)
 		{
@@ -988,7 +1155,7 @@ void ALC_APIENTRY AlApiImpl::alc_process_context(
 	ALCcontext* context) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_alc_symbols_->alcProcessContext(context);
 }
@@ -1001,7 +1168,7 @@ void ALC_APIENTRY AlApiImpl::alc_suspend_context(
 	ALCcontext* context) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_alc_symbols_->alcSuspendContext(context);
 }
@@ -1025,7 +1192,7 @@ try
 
 	const auto mt_lock = initialize();
 
-	auto& our_context = get_context(context);
+	auto& our_context = *get_context_entry(context).context;
 
 	if (&our_context == current_context_)
 	{
@@ -1034,9 +1201,27 @@ try
 	}
 
 	current_context_ = nullptr;
+	current_device_ = nullptr;
 
-	our_context.alc_destroy();
-	remove_context(our_context);
+	// The driver resets the thread's context while making our context current to destroy it.
+	//
+	thread_context_ = nullptr;
+	thread_device_ = nullptr;
+
+	// Wait for the pending calls on the context.
+	//
+	// No one can acquire the context's lock without the global one,
+	// so the context can be safely removed after the block.
+	//
+	{
+		const auto context_lock = our_context.get_lock();
+		our_context.alc_destroy();
+	}
+
+	remove_context(context);
+
+	g_al_api_stats.log();
+	g_mutex_profiler.log(logger_);
 }
 catch (...)
 {
@@ -1048,12 +1233,14 @@ try
 {
 	const auto mt_lock = initialize();
 
-	if (!current_context_)
+	const auto context = find_context();
+
+	if (!context)
 	{
 		return nullptr;
 	}
 
-	return current_context_->get_al_context();
+	return context->get_al_context();
 }
 catch (...)
 {
@@ -1065,7 +1252,7 @@ ALCdevice* ALC_APIENTRY AlApiImpl::alc_get_contexts_device(
 	ALCcontext* context) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_alc_symbols_->alcGetContextsDevice(context);
 }
@@ -1148,12 +1335,16 @@ try
 
 	log_device_info(al_device);
 
-	devices_.emplace_back(Device{});
-	auto& device = devices_.back();
+	auto device = std::make_unique<Device>();
+	device->mutex = g_mutex_profiler.make_mutex("AL device");
+	device->special_name = special_device_name;
+	device->al_device = al_device;
+	device->x_ram_free_size = x_ram_max_size;
 
-	device.special_name = special_device_name;
-	device.al_device = al_device;
-	device.x_ram_free_size = x_ram_max_size;
+	if (!devices_.add(al_device, std::move(device)))
+	{
+		fail("Device already registered.");
+	}
 
 	return al_device;
 }
@@ -1178,13 +1369,18 @@ try
 	string_buffer_ += '.';
 	logger_.info(string_buffer_.c_str());
 
-	devices_.remove_if(
-		[al_device = device](
-			const Device& device)
+	// Wait for the pending calls on the device.
+	//
+	{
+		const auto our_device = find_device(device);
+
+		if (our_device)
 		{
-			return device.al_device == al_device;
+			const auto device_lock = MoveableMutexLock{*our_device->mutex};
 		}
-	);
+	}
+
+	remove_device(device);
 
 	const auto al_result = al_alc_symbols_->alcCloseDevice(device);
 
@@ -1205,7 +1401,7 @@ ALCenum ALC_APIENTRY AlApiImpl::alc_get_error(
 	ALCdevice* device) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	const auto alc_result = al_alc_symbols_->alcGetError(device);
 
@@ -1222,7 +1418,7 @@ ALCboolean ALC_APIENTRY AlApiImpl::alc_is_extension_present(
 	const ALCchar* extname) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_alc_symbols_->alcIsExtensionPresent(device, extname);
 }
@@ -1237,7 +1433,7 @@ void* ALC_APIENTRY AlApiImpl::alc_get_proc_address(
 	const ALCchar* funcname) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	if (funcname && (*funcname) != '\0')
 	{
@@ -1248,6 +1444,28 @@ try
 		{
 			return alc_symbol_it->second;
 		}
+
+		constexpr auto alc_set_thread_context_view = std::string_view{AlAlcThreadLocalContextSymbolsNames::alcSetThreadContext};
+		constexpr auto alc_get_thread_context_view = std::string_view{AlAlcThreadLocalContextSymbolsNames::alcGetThreadContext};
+
+		if (symbol_name == alc_set_thread_context_view || symbol_name == alc_get_thread_context_view)
+		{
+			// Never hand out the driver's ones.
+			//
+			if (!alc_set_thread_context_)
+			{
+				return nullptr;
+			}
+
+			if (symbol_name == alc_set_thread_context_view)
+			{
+				return reinterpret_cast<void*>(eaxefx::alcSetThreadContext);
+			}
+			else
+			{
+				return reinterpret_cast<void*>(eaxefx::alcGetThreadContext);
+			}
+		}
 	}
 
 	return al_alc_symbols_->alcGetProcAddress(device, funcname);
@@ -1263,7 +1481,7 @@ ALCenum ALC_APIENTRY AlApiImpl::alc_get_enum_value(
 	const ALCchar* enumname) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_alc_symbols_->alcGetEnumValue(device, enumname);
 }
@@ -1305,7 +1523,7 @@ void ALC_APIENTRY AlApiImpl::alc_get_integer_v(
 	ALCint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_alc_symbols_->alcGetIntegerv(device, param, size, values);
 }
@@ -1321,7 +1539,7 @@ ALCdevice* ALC_APIENTRY AlApiImpl::alc_capture_open_device(
 	ALCsizei buffersize) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_alc_symbols_->alcCaptureOpenDevice(devicename, frequency, format, buffersize);
 }
@@ -1335,7 +1553,7 @@ ALCboolean ALC_APIENTRY AlApiImpl::alc_capture_close_device(
 	ALCdevice* device) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_alc_symbols_->alcCaptureCloseDevice(device);;
 }
@@ -1349,7 +1567,7 @@ void ALC_APIENTRY AlApiImpl::alc_capture_start(
 	ALCdevice* device) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_alc_symbols_->alcCaptureStart(device);
 }
@@ -1362,7 +1580,7 @@ void ALC_APIENTRY AlApiImpl::alc_capture_stop(
 	ALCdevice* device) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_alc_symbols_->alcCaptureStop(device);
 }
@@ -1377,7 +1595,7 @@ void ALC_APIENTRY AlApiImpl::alc_capture_samples(
 	ALCsizei samples) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_alc_symbols_->alcCaptureSamples(device, buffer, samples);
 }
@@ -1396,7 +1614,7 @@ void AL_APIENTRY AlApiImpl::alDopplerFactor(
 	ALfloat value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alDopplerFactor(value);
 }
@@ -1409,7 +1627,7 @@ void AL_APIENTRY AlApiImpl::alDopplerVelocity(
 	ALfloat value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alDopplerVelocity(value);
 }
@@ -1422,7 +1640,7 @@ void AL_APIENTRY AlApiImpl::alSpeedOfSound(
 	ALfloat value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSpeedOfSound(value);
 }
@@ -1435,7 +1653,7 @@ void AL_APIENTRY AlApiImpl::alDistanceModel(
 	ALenum distanceModel) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alDistanceModel(distanceModel);
 }
@@ -1448,7 +1666,7 @@ void AL_APIENTRY AlApiImpl::alEnable(
 	ALenum capability) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alEnable(capability);
 }
@@ -1461,7 +1679,7 @@ void AL_APIENTRY AlApiImpl::alDisable(
 	ALenum capability) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alDisable(capability);
 }
@@ -1474,7 +1692,7 @@ ALboolean AL_APIENTRY AlApiImpl::alIsEnabled(
 	ALenum capability) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_al_symbols_->alIsEnabled(capability);
 }
@@ -1490,9 +1708,11 @@ try
 {
 	const auto mt_lock = initialize();
 
-	if (current_context_)
+	const auto context = find_context();
+
+	if (context)
 	{
-		const auto al_string = current_context_->al_get_string(param);
+		const auto al_string = context->al_get_string(param);
 
 		if (al_string)
 		{
@@ -1513,7 +1733,7 @@ void AL_APIENTRY AlApiImpl::alGetBooleanv(
 	ALboolean* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetBooleanv(param, values);
 }
@@ -1527,7 +1747,7 @@ void AL_APIENTRY AlApiImpl::alGetIntegerv(
 	ALint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetIntegerv(param, values);
 }
@@ -1541,7 +1761,7 @@ void AL_APIENTRY AlApiImpl::alGetFloatv(
 	ALfloat* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetFloatv(param, values);
 }
@@ -1555,7 +1775,7 @@ void AL_APIENTRY AlApiImpl::alGetDoublev(
 	ALdouble* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetDoublev(param, values);
 }
@@ -1568,7 +1788,7 @@ ALboolean AL_APIENTRY AlApiImpl::alGetBoolean(
 	ALenum param) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_al_symbols_->alGetBoolean(param);
 }
@@ -1582,20 +1802,20 @@ ALint AL_APIENTRY AlApiImpl::alGetInteger(
 	ALenum param) noexcept
 try
 {
-	const auto mt_lock = initialize();
-
 	switch (param)
 	{
 		case x_ram_ram_size_enum:
+			initialize_lock_free();
 			return x_ram_max_size;
 
 		case x_ram_ram_free_enum:
 			{
-				const auto& device = get_current_device();
-				return device.x_ram_free_size;
+				const auto locked_device = lock_current_device();
+				return locked_device.device->x_ram_free_size;
 			}
 
 		default:
+			initialize_lock_free();
 			return al_al_symbols_->alGetInteger(param);
 	}
 }
@@ -1609,7 +1829,7 @@ ALfloat AL_APIENTRY AlApiImpl::alGetFloat(
 	ALenum param) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_al_symbols_->alGetFloat(param);
 }
@@ -1623,7 +1843,7 @@ ALdouble AL_APIENTRY AlApiImpl::alGetDouble(
 	ALenum param) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_al_symbols_->alGetDouble(param);
 }
@@ -1636,7 +1856,7 @@ catch (...)
 ALenum AL_APIENTRY AlApiImpl::alGetError() noexcept
 try
 {
-	const auto mt_lock = initialize();
+	const auto locked_context = try_lock_current_context();
 
 	const auto al_result = al_al_symbols_->alGetError();
 	return al_result;
@@ -1653,7 +1873,9 @@ try
 {
 	const auto mt_lock = initialize();
 
-	if (current_context_)
+	const auto context = find_context();
+
+	if (context)
 	{
 		if (extname && extname[0] != '\0')
 		{
@@ -1667,7 +1889,7 @@ try
 			}
 		}
 
-		const auto is_present = current_context_->al_is_extension_present(extname);
+		const auto is_present = context->al_is_extension_present(extname);
 
 		if (is_present)
 		{
@@ -1718,9 +1940,11 @@ try
 		return al_symbol_it->second;
 	}
 
-	if (current_context_)
+	const auto context = find_context();
+
+	if (context)
 	{
-		const auto symbol = current_context_->al_get_proc_address(symbol_name);
+		const auto symbol = context->al_get_proc_address(symbol_name);
 
 		if (symbol)
 		{
@@ -1751,7 +1975,7 @@ try
 	constexpr auto x_ram_al_storage_hardware_view = std::string_view{"AL_STORAGE_HARDWARE"};
 	constexpr auto x_ram_al_storage_accessible_view = std::string_view{"AL_STORAGE_ACCESSIBLE"};
 
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	const auto ename_view = std::string_view{ename};
 
@@ -1794,7 +2018,7 @@ void AL_APIENTRY AlApiImpl::alListenerf(
 	ALfloat value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alListenerf(param, value);
 }
@@ -1810,7 +2034,7 @@ void AL_APIENTRY AlApiImpl::alListener3f(
 	ALfloat value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alListener3f(param, value1, value2, value3);
 }
@@ -1824,7 +2048,7 @@ void AL_APIENTRY AlApiImpl::alListenerfv(
 	const ALfloat* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alListenerfv(param, values);
 }
@@ -1838,7 +2062,7 @@ void AL_APIENTRY AlApiImpl::alListeneri(
 	ALint value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alListeneri(param, value);
 }
@@ -1854,7 +2078,7 @@ void AL_APIENTRY AlApiImpl::alListener3i(
 	ALint value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alListener3i(param, value1, value2, value3);
 }
@@ -1868,7 +2092,7 @@ void AL_APIENTRY AlApiImpl::alListeneriv(
 	const ALint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alListeneriv(param, values);
 }
@@ -1882,7 +2106,7 @@ void AL_APIENTRY AlApiImpl::alGetListenerf(
 	ALfloat* value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetListenerf(param, value);
 }
@@ -1898,7 +2122,7 @@ void AL_APIENTRY AlApiImpl::alGetListener3f(
 	ALfloat* value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetListener3f(param, value1, value2, value3);
 }
@@ -1912,7 +2136,7 @@ void AL_APIENTRY AlApiImpl::alGetListenerfv(
 	ALfloat* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetListenerfv(param, values);
 }
@@ -1926,7 +2150,7 @@ void AL_APIENTRY AlApiImpl::alGetListeneri(
 	ALint* value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetListeneri(param, value);
 }
@@ -1942,7 +2166,7 @@ void AL_APIENTRY AlApiImpl::alGetListener3i(
 	ALint* value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetListener3i(param, value1, value2, value3);
 }
@@ -1956,7 +2180,7 @@ void AL_APIENTRY AlApiImpl::alGetListeneriv(
 	ALint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetListeneriv(param, values);
 }
@@ -1977,7 +2201,7 @@ try
 		return;
 	}
 
-	const auto mt_lock = initialize();
+	const auto locked_context = lock_current_context();
 
 	static_cast<void>(al_al_symbols_->alGetError());
 	al_al_symbols_->alGenSources(n, sources);
@@ -1989,8 +2213,7 @@ try
 		return;
 	}
 
-	auto& context = get_current_context();
-	context.al_gen_sources(al_source_ids);
+	locked_context.context->al_gen_sources(al_source_ids);
 }
 catch (...)
 {
@@ -2009,7 +2232,7 @@ try
 		return;
 	}
 
-	const auto mt_lock = initialize();
+	const auto locked_context = lock_current_context();
 
 	static_cast<void>(al_al_symbols_->alGetError());
 	al_al_symbols_->alDeleteSources(n, sources);
@@ -2021,8 +2244,7 @@ try
 		return;
 	}
 
-	auto& context = get_current_context();
-	context.al_delete_sources(al_source_ids);
+	locked_context.context->al_delete_sources(al_source_ids);
 }
 catch (...)
 {
@@ -2033,7 +2255,7 @@ ALboolean AL_APIENTRY AlApiImpl::alIsSource(
 	ALuint source) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_al_symbols_->alIsSource(source);
 }
@@ -2049,7 +2271,7 @@ void AL_APIENTRY AlApiImpl::alSourcef(
 	ALfloat value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourcef(source, param, value);
 }
@@ -2066,7 +2288,7 @@ void AL_APIENTRY AlApiImpl::alSource3f(
 	ALfloat value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSource3f(source, param, value1, value2, value3);
 }
@@ -2081,7 +2303,7 @@ void AL_APIENTRY AlApiImpl::alSourcefv(
 	const ALfloat* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourcefv(source, param, values);
 }
@@ -2096,7 +2318,7 @@ void AL_APIENTRY AlApiImpl::alSourcei(
 	ALint value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourcei(source, param, value);
 }
@@ -2113,7 +2335,7 @@ void AL_APIENTRY AlApiImpl::alSource3i(
 	ALint value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSource3i(source, param, value1, value2, value3);
 }
@@ -2128,7 +2350,7 @@ void AL_APIENTRY AlApiImpl::alSourceiv(
 	const ALint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourceiv(source, param, values);
 }
@@ -2143,7 +2365,7 @@ void AL_APIENTRY AlApiImpl::alGetSourcef(
 	ALfloat* value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetSourcef(source, param, value);
 }
@@ -2160,7 +2382,7 @@ void AL_APIENTRY AlApiImpl::alGetSource3f(
 	ALfloat* value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetSource3f(source, param, value1, value2, value3);
 }
@@ -2175,7 +2397,7 @@ void AL_APIENTRY AlApiImpl::alGetSourcefv(
 	ALfloat* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetSourcefv(source, param, values);
 }
@@ -2190,7 +2412,7 @@ void AL_APIENTRY AlApiImpl::alGetSourcei(
 	ALint* value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetSourcei(source, param, value);
 }
@@ -2207,7 +2429,7 @@ void AL_APIENTRY AlApiImpl::alGetSource3i(
 	ALint* value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetSource3i(source, param, value1, value2, value3);
 }
@@ -2222,7 +2444,7 @@ void AL_APIENTRY AlApiImpl::alGetSourceiv(
 	ALint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetSourceiv(source, param, values);
 }
@@ -2236,7 +2458,7 @@ void AL_APIENTRY AlApiImpl::alSourcePlayv(
 	const ALuint* sources) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourcePlayv(n, sources);
 }
@@ -2250,7 +2472,7 @@ void AL_APIENTRY AlApiImpl::alSourceStopv(
 	const ALuint* sources) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourceStopv(n, sources);
 }
@@ -2264,7 +2486,7 @@ void AL_APIENTRY AlApiImpl::alSourceRewindv(
 	const ALuint* sources) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourceRewindv(n, sources);
 }
@@ -2278,7 +2500,7 @@ void AL_APIENTRY AlApiImpl::alSourcePausev(
 	const ALuint* sources) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourcePausev(n, sources);
 }
@@ -2291,7 +2513,7 @@ void AL_APIENTRY AlApiImpl::alSourcePlay(
 	ALuint source) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourcePlay(source);
 }
@@ -2304,7 +2526,7 @@ void AL_APIENTRY AlApiImpl::alSourceStop(
 	ALuint source) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourceStop(source);
 }
@@ -2317,7 +2539,7 @@ void AL_APIENTRY AlApiImpl::alSourceRewind(
 	ALuint source) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourceRewind(source);
 }
@@ -2330,7 +2552,7 @@ void AL_APIENTRY AlApiImpl::alSourcePause(
 	ALuint source) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourcePause(source);
 }
@@ -2345,7 +2567,7 @@ void AL_APIENTRY AlApiImpl::alSourceQueueBuffers(
 	const ALuint* buffers) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourceQueueBuffers(source, nb, buffers);
 }
@@ -2360,7 +2582,7 @@ void AL_APIENTRY AlApiImpl::alSourceUnqueueBuffers(
 	ALuint* buffers) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alSourceUnqueueBuffers(source, nb, buffers);
 }
@@ -2381,7 +2603,7 @@ try
 		return;
 	}
 
-	const auto mt_lock = initialize();
+	const auto locked_device = lock_current_device();
 
 	static_cast<void>(al_al_symbols_->alGetError());
 	al_al_symbols_->alGenBuffers(n, buffers);
@@ -2393,8 +2615,7 @@ try
 		return;
 	}
 
-	auto& device = get_current_device();
-	auto& our_buffers = device.buffers;
+	auto& our_buffers = locked_device.device->buffers;
 
 	auto our_buffer = Buffer{};
 	our_buffer.x_ram_mode = x_ram_al_storage_automatic_enum;
@@ -2421,7 +2642,7 @@ try
 		return;
 	}
 
-	const auto mt_lock = initialize();
+	const auto locked_device = lock_current_device();
 
 	static_cast<void>(al_al_symbols_->alGetError());
 	al_al_symbols_->alDeleteBuffers(n, buffers);
@@ -2433,7 +2654,7 @@ try
 		return;
 	}
 
-	auto& device = get_current_device();
+	auto& device = *locked_device.device;
 	auto& our_buffers = device.buffers;
 
 	for (const auto al_buffer_id : al_buffer_ids)
@@ -2470,7 +2691,7 @@ ALboolean AL_APIENTRY AlApiImpl::alIsBuffer(
 	ALuint buffer) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	return al_al_symbols_->alIsBuffer(buffer);
 }
@@ -2488,9 +2709,9 @@ void AL_APIENTRY AlApiImpl::alBufferData(
 	ALsizei freq) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	const auto locked_device = lock_current_device();
 
-	auto& device = get_current_device();
+	auto& device = *locked_device.device;
 	auto& our_buffer = get_buffer(device, buffer);
 
 
@@ -2594,7 +2815,7 @@ void AL_APIENTRY AlApiImpl::alBufferf(
 	ALfloat value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alBufferf(buffer, param, value);
 }
@@ -2611,7 +2832,7 @@ void AL_APIENTRY AlApiImpl::alBuffer3f(
 	ALfloat value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alBuffer3f(buffer, param, value1, value2, value3);
 }
@@ -2626,7 +2847,7 @@ void AL_APIENTRY AlApiImpl::alBufferfv(
 	const ALfloat* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alBufferfv(buffer, param, values);
 }
@@ -2641,7 +2862,7 @@ void AL_APIENTRY AlApiImpl::alBufferi(
 	ALint value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alBufferi(buffer, param, value);
 }
@@ -2658,7 +2879,7 @@ void AL_APIENTRY AlApiImpl::alBuffer3i(
 	ALint value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alBuffer3i(buffer, param, value1, value2, value3);
 }
@@ -2673,7 +2894,7 @@ void AL_APIENTRY AlApiImpl::alBufferiv(
 	const ALint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alBufferiv(buffer, param, values);
 }
@@ -2688,7 +2909,7 @@ void AL_APIENTRY AlApiImpl::alGetBufferf(
 	ALfloat* value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetBufferf(buffer, param, value);
 }
@@ -2705,7 +2926,7 @@ void AL_APIENTRY AlApiImpl::alGetBuffer3f(
 	ALfloat* value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetBuffer3f(buffer, param, value1, value2, value3);
 }
@@ -2720,7 +2941,7 @@ void AL_APIENTRY AlApiImpl::alGetBufferfv(
 	ALfloat* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetBufferfv(buffer, param, values);
 }
@@ -2735,7 +2956,7 @@ void AL_APIENTRY AlApiImpl::alGetBufferi(
 	ALint* value) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetBufferi(buffer, param, value);
 }
@@ -2752,7 +2973,7 @@ void AL_APIENTRY AlApiImpl::alGetBuffer3i(
 	ALint* value3) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetBuffer3i(buffer, param, value1, value2, value3);
 }
@@ -2767,7 +2988,7 @@ void AL_APIENTRY AlApiImpl::alGetBufferiv(
 	ALint* values) noexcept
 try
 {
-	const auto mt_lock = initialize();
+	initialize_lock_free();
 
 	al_al_symbols_->alGetBufferiv(buffer, param, values);
 }
@@ -2907,6 +3128,41 @@ void AlApiImpl::initialize_al_symbols()
 
 	logger_.info("Load AL v1.1 symbols.");
 	al_al_symbols_ = al_loader_->resolve_al_symbols();
+
+	g_al_api_stats.instrument(*al_alc_symbols_);
+	g_al_api_stats.instrument(*al_al_symbols_);
+
+	initialize_al_thread_local_context_symbols();
+}
+
+void AlApiImpl::initialize_al_thread_local_context_symbols() noexcept
+{
+	alc_set_thread_context_ = nullptr;
+	alc_get_thread_context_ = nullptr;
+
+	const auto is_supported = (al_alc_symbols_->alcIsExtensionPresent(nullptr, "ALC_EXT_thread_local_context") != ALC_FALSE);
+
+	if (!is_supported)
+	{
+		logger_.info("ALC_EXT_thread_local_context not supported.");
+		return;
+	}
+
+	logger_.info("Load ALC_EXT_thread_local_context symbols.");
+
+	alc_set_thread_context_ = reinterpret_cast<PFNALCSETTHREADCONTEXTPROC>(al_alc_symbols_->alcGetProcAddress(
+		nullptr, AlAlcThreadLocalContextSymbolsNames::alcSetThreadContext));
+
+	alc_get_thread_context_ = reinterpret_cast<PFNALCGETTHREADCONTEXTPROC>(al_alc_symbols_->alcGetProcAddress(
+		nullptr, AlAlcThreadLocalContextSymbolsNames::alcGetThreadContext));
+
+	if (!alc_set_thread_context_ || !alc_get_thread_context_)
+	{
+		logger_.warning("Failed to load ALC_EXT_thread_local_context symbols.");
+
+		alc_set_thread_context_ = nullptr;
+		alc_get_thread_context_ = nullptr;
+	}
 }
 
 void AlApiImpl::initialize_al_alc_symbol_map() noexcept
@@ -3026,19 +3282,11 @@ void AlApiImpl::initialize_al_wrapper_entries() noexcept
 	initialize_al_al_symbol_map();
 }
 
-MoveableMutexLock AlApiImpl::initialize_invalid_state()
-{
-	fail(ErrorMessages::invalid_state);
-}
-
-MoveableMutexLock AlApiImpl::initialize_not_initialized()
-{
-	fail(ErrorMessages::not_initialized);
-}
-
 MoveableMutexLock AlApiImpl::initialize_lock_mutex()
 {
 	assert(mutex_);
+
+	const auto lock_wait_scope = AlApiStatsLockWaitScope{};
 	return MoveableMutexLock{*mutex_};
 }
 
@@ -3048,8 +3296,26 @@ try
 	assert(mutex_);
 	auto mt_lock = MoveableMutexLock{*mutex_};
 
+	// Another thread may have finished (or failed) the initialization while we were waiting.
+	//
+	switch (initialize_state_.load(std::memory_order_acquire))
+	{
+		case InitializeState::try_to_initialize:
+			break;
+
+		case InitializeState::initialized:
+			return mt_lock;
+
+		case InitializeState::not_initialized:
+			fail(ErrorMessages::not_initialized);
+
+		default:
+			fail(ErrorMessages::invalid_state);
+	}
+
 
 	initialize_logger();
+	g_al_api_stats.initialize(&logger_);
 	initialize_al_driver();
 	initialize_al_symbols();
 	initialize_al_wrapper_entries();
@@ -3058,34 +3324,62 @@ try
 
 	log_devices_info();
 
-	initialize_func_ = &AlApiImpl::initialize_lock_mutex;
+	initialize_state_.store(InitializeState::initialized, std::memory_order_release);
 
 	return mt_lock;
 }
 catch (...)
 {
-	initialize_func_ = &AlApiImpl::initialize_not_initialized;
+	auto expected_state = InitializeState::try_to_initialize;
+
+	initialize_state_.compare_exchange_strong(
+		expected_state,
+		InitializeState::not_initialized,
+		std::memory_order_acq_rel
+	);
+
 	throw;
 }
 
 MoveableMutexLock AlApiImpl::initialize()
 {
-	assert(initialize_func_);
-	return (this->*initialize_func_)();
+	switch (initialize_state_.load(std::memory_order_acquire))
+	{
+		case InitializeState::initialized:
+			return initialize_lock_mutex();
+
+		case InitializeState::try_to_initialize:
+			return initialize_try_to_initialize();
+
+		case InitializeState::not_initialized:
+			fail(ErrorMessages::not_initialized);
+
+		default:
+			fail(ErrorMessages::invalid_state);
+	}
+}
+
+void AlApiImpl::initialize_lock_free()
+{
+	if (initialize_state_.load(std::memory_order_acquire) == InitializeState::initialized)
+	{
+		return;
+	}
+
+	static_cast<void>(initialize());
 }
 
 AlApiImpl::Device* AlApiImpl::find_device(
 	ALCdevice* al_device) noexcept
 {
-	for (auto& device : devices_)
+	const auto device = devices_.find(al_device);
+
+	if (!device)
 	{
-		if (device.al_device == al_device)
-		{
-			return &device;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	return device->get();
 }
 
 AlApiImpl::Device& AlApiImpl::get_device(
@@ -3101,25 +3395,82 @@ AlApiImpl::Device& AlApiImpl::get_device(
 	return *device;
 }
 
+AlApiImpl::Device* AlApiImpl::find_current_device() noexcept
+{
+	if (thread_context_)
+	{
+		return thread_device_;
+	}
+
+	return current_device_;
+}
+
 AlApiImpl::Device& AlApiImpl::get_current_device()
 {
-	if (!current_context_)
+	const auto device = find_current_device();
+
+	if (!device)
 	{
-		fail("No current context.");
+		fail("No current device.");
 	}
 
-	for (auto& device : devices_)
+	return *device;
+}
+
+void AlApiImpl::remove_device(
+	ALCdevice* al_device)
+{
+	const auto device = find_device(al_device);
+
+	if (!device)
 	{
-		for (auto& context : device.contexts)
+		return;
+	}
+
+	// Destroy the contexts the application did not.
+	//
+	auto al_contexts = std::vector<ALCcontext*>{};
+
+	contexts_.for_each(
+		[device, &al_contexts](
+			ALCcontext* al_context,
+			const ContextEntry& context)
 		{
-			if (context.get() == current_context_)
+			if (context.device == device)
 			{
-				return device;
+				al_contexts.emplace_back(al_context);
 			}
 		}
+	);
+
+	for (const auto al_context : al_contexts)
+	{
+		remove_context(al_context);
 	}
 
-	fail("Unregistered device.");
+	if (current_device_ == device)
+	{
+		current_context_ = nullptr;
+		current_device_ = nullptr;
+	}
+
+	if (thread_device_ == device)
+	{
+		thread_context_ = nullptr;
+		thread_device_ = nullptr;
+	}
+
+	static_cast<void>(devices_.remove(al_device));
+}
+
+AlApiImpl::LockedDevice AlApiImpl::lock_current_device()
+{
+	const auto mt_lock = initialize();
+
+	auto& device = get_current_device();
+
+	const auto lock_wait_scope = AlApiStatsLockWaitScope{};
+	return LockedDevice{MoveableMutexLock{*device.mutex}, &device};
 }
 
 AlApiImpl::Buffer& AlApiImpl::get_buffer(
@@ -3137,69 +3488,62 @@ AlApiImpl::Buffer& AlApiImpl::get_buffer(
 	return buffer_it->second;
 }
 
-AlApiImpl::Buffer& AlApiImpl::get_current_buffer(
-	ALuint al_buffer_name)
+AlApiContext* AlApiImpl::find_context() noexcept
 {
-	auto& device = get_current_device();
-	return get_buffer(device, al_buffer_name);
+	if (thread_context_)
+	{
+		return thread_context_;
+	}
+
+	return current_context_;
 }
 
 AlApiContext& AlApiImpl::get_context()
 {
-	if (!current_context_)
+	const auto context = find_context();
+
+	if (!context)
 	{
 		fail("No current context.");
 	}
 
-	return *current_context_;
+	return *context;
 }
 
-AlApiContext& AlApiImpl::get_context(
+AlApiImpl::ContextEntry& AlApiImpl::get_context_entry(
 	ALCcontext* al_context)
 {
-	for (auto& device : devices_)
+	const auto context = contexts_.find(al_context);
+
+	if (!context)
 	{
-		for (auto& context : device.contexts)
-		{
-			if (context->get_al_context() == al_context)
-			{
-				return *context;
-			}
-		}
+		fail("Unregistered context.");
 	}
 
-	fail("Unregistered context.");
+	return *context;
 }
 
-void AlApiImpl::remove_context(
-	const AlApiContext& context)
+AlApiLockedContext AlApiImpl::try_lock_current_context()
 {
-	auto is_removed = false;
-
-	for (auto& device : devices_)
+	if (thread_context_)
 	{
-		auto& contexts = device.contexts;
-
-		const auto old_context_count = contexts.size();
-
-		contexts.remove_if(
-			[&context_to_remove = context](
-				const AlApiContextUPtr& context)
-			{
-				return context.get() == &context_to_remove;
-			}
-		);
+		return AlApiLockedContext{thread_context_->get_lock(), thread_context_};
+	}
 
-		const auto new_context_count = contexts.size();
+	const auto mt_lock = initialize();
 
-		if (old_context_count != new_context_count)
-		{
-			is_removed = true;
-			break;
-		}
+	if (!current_context_)
+	{
+		return AlApiLockedContext{};
 	}
 
-	if (!is_removed)
+	return AlApiLockedContext{current_context_->get_lock(), current_context_};
+}
+
+void AlApiImpl::remove_context(
+	ALCcontext* al_context)
+{
+	if (!contexts_.remove(al_context))
 	{
 		fail("Unregistered context.");
 	}
@@ -3322,59 +3666,79 @@ ALC_API ALCcontext* ALC_APIENTRY alcCreateContext(
 	ALCdevice* device,
 	const ALCint* attrlist)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcCreateContext};
+
 	return eaxefx::g_al_api_impl.alc_create_context(device, attrlist);
 }
 
 ALC_API ALCboolean ALC_APIENTRY alcMakeContextCurrent(
 	ALCcontext* context)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcMakeContextCurrent};
+
 	return eaxefx::g_al_api_impl.alc_make_context_current(context);
 }
 
 ALC_API void ALC_APIENTRY alcProcessContext(
 	ALCcontext* context)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcProcessContext};
+
 	eaxefx::g_al_api_impl.alc_process_context(context);
 }
 
 ALC_API void ALC_APIENTRY alcSuspendContext(
 	ALCcontext* context)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcSuspendContext};
+
 	eaxefx::g_al_api_impl.alc_suspend_context(context);
 }
 
 ALC_API void ALC_APIENTRY alcDestroyContext(
 	ALCcontext* context)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcDestroyContext};
+
 	eaxefx::g_al_api_impl.alc_destroy_context(context);
 }
 
 ALC_API ALCcontext* ALC_APIENTRY alcGetCurrentContext()
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcGetCurrentContext};
+
 	return eaxefx::g_al_api_impl.alc_get_current_context();
 }
 
 ALC_API ALCdevice* ALC_APIENTRY alcGetContextsDevice(
 	ALCcontext* context)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcGetContextsDevice};
+
 	return eaxefx::g_al_api_impl.alc_get_contexts_device(context);
 }
 
 ALC_API ALCdevice* ALC_APIENTRY alcOpenDevice(
 	const ALCchar* devicename)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcOpenDevice};
+
 	return eaxefx::g_al_api_impl.alc_open_device(devicename);
 }
 
 ALC_API ALCboolean ALC_APIENTRY alcCloseDevice(
 	ALCdevice* device)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcCloseDevice};
+
 	return eaxefx::g_al_api_impl.alc_close_device(device);
 }
 
 ALC_API ALCenum ALC_APIENTRY alcGetError(
 	ALCdevice* device)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcGetError};
+
 	return eaxefx::g_al_api_impl.alc_get_error(device);
 }
 
@@ -3382,6 +3746,8 @@ ALC_API ALCboolean ALC_APIENTRY alcIsExtensionPresent(
 	ALCdevice* device,
 	const ALCchar* extname)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcIsExtensionPresent};
+
 	return eaxefx::g_al_api_impl.alc_is_extension_present(device, extname);
 }
 
@@ -3389,6 +3755,8 @@ ALC_API void* ALC_APIENTRY alcGetProcAddress(
 	ALCdevice* device,
 	const ALCchar* funcname)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcGetProcAddress};
+
 	return eaxefx::g_al_api_impl.alc_get_proc_address(device, funcname);
 }
 
@@ -3396,6 +3764,8 @@ ALC_API ALCenum ALC_APIENTRY alcGetEnumValue(
 	ALCdevice* device,
 	const ALCchar* enumname)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcGetEnumValue};
+
 	return eaxefx::g_al_api_impl.alc_get_enum_value(device, enumname);
 }
 
@@ -3403,6 +3773,8 @@ ALC_API const ALCchar* ALC_APIENTRY alcGetString(
 	ALCdevice* device,
 	ALCenum param)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcGetString};
+
 	return eaxefx::g_al_api_impl.alc_get_string(device, param);
 }
 
@@ -3412,6 +3784,8 @@ ALC_API void ALC_APIENTRY alcGetIntegerv(
 	ALCsizei size,
 	ALCint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcGetIntegerv};
+
 	eaxefx::g_al_api_impl.alc_get_integer_v(device, param, size, values);
 }
 
@@ -3421,23 +3795,31 @@ ALC_API ALCdevice* ALC_APIENTRY alcCaptureOpenDevice(
 	ALCenum format,
 	ALCsizei buffersize)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcCaptureOpenDevice};
+
 	return eaxefx::g_al_api_impl.alc_capture_open_device(devicename, frequency, format, buffersize);
 }
 
 ALC_API ALCboolean ALC_APIENTRY alcCaptureCloseDevice(
 	ALCdevice* device)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcCaptureCloseDevice};
+
 	return eaxefx::g_al_api_impl.alc_capture_close_device(device);
 }
 
 ALC_API void ALC_APIENTRY alcCaptureStart(
 	ALCdevice* device)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcCaptureStart};
+
 	eaxefx::g_al_api_impl.alc_capture_start(device);
 }
 
 ALC_API void ALC_APIENTRY alcCaptureStop(ALCdevice* device)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcCaptureStop};
+
 	eaxefx::g_al_api_impl.alc_capture_stop(device);
 }
 
@@ -3446,6 +3828,8 @@ ALC_API void ALC_APIENTRY alcCaptureSamples(
 	ALCvoid* buffer,
 	ALCsizei samples)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlcSymbolsNames::alcCaptureSamples};
+
 	eaxefx::g_al_api_impl.alc_capture_samples(device, buffer, samples);
 }
 
@@ -3459,48 +3843,64 @@ ALC_API void ALC_APIENTRY alcCaptureSamples(
 AL_API void AL_APIENTRY alDopplerFactor(
 	ALfloat value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alDopplerFactor};
+
 	eaxefx::g_al_api_impl.alDopplerFactor(value);
 }
 
 AL_API void AL_APIENTRY alDopplerVelocity(
 	ALfloat value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alDopplerVelocity};
+
 	eaxefx::g_al_api_impl.alDopplerVelocity(value);
 }
 
 AL_API void AL_APIENTRY alSpeedOfSound(
 	ALfloat value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSpeedOfSound};
+
 	eaxefx::g_al_api_impl.alSpeedOfSound(value);
 }
 
 AL_API void AL_APIENTRY alDistanceModel(
 	ALenum distanceModel)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alDistanceModel};
+
 	eaxefx::g_al_api_impl.alDistanceModel(distanceModel);
 }
 
 AL_API void AL_APIENTRY alEnable(
 	ALenum capability)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alEnable};
+
 	eaxefx::g_al_api_impl.alEnable(capability);
 }
 
 AL_API void AL_APIENTRY alDisable(
 	ALenum capability)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alDisable};
+
 	eaxefx::g_al_api_impl.alDisable(capability);
 }
 
 AL_API ALboolean AL_APIENTRY alIsEnabled(
 	ALenum capability)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alIsEnabled};
+
 	return eaxefx::g_al_api_impl.alIsEnabled(capability);
 }
 
 AL_API const ALchar* AL_APIENTRY alGetString(
 	ALenum param)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetString};
+
 	return eaxefx::g_al_api_impl.alGetString(param);
 }
 
@@ -3508,6 +3908,8 @@ AL_API void AL_APIENTRY alGetBooleanv(
 	ALenum param,
 	ALboolean* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBooleanv};
+
 	eaxefx::g_al_api_impl.alGetBooleanv(param, values);
 }
 
@@ -3515,6 +3917,8 @@ AL_API void AL_APIENTRY alGetIntegerv(
 	ALenum param,
 	ALint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetIntegerv};
+
 	eaxefx::g_al_api_impl.alGetIntegerv(param, values);
 }
 
@@ -3522,6 +3926,8 @@ AL_API void AL_APIENTRY alGetFloatv(
 	ALenum param,
 	ALfloat* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetFloatv};
+
 	eaxefx::g_al_api_impl.alGetFloatv(param, values);
 }
 
@@ -3529,53 +3935,71 @@ AL_API void AL_APIENTRY alGetDoublev(
 	ALenum param,
 	ALdouble* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetDoublev};
+
 	eaxefx::g_al_api_impl.alGetDoublev(param, values);
 }
 
 AL_API ALboolean AL_APIENTRY alGetBoolean(
 	ALenum param)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBoolean};
+
 	return eaxefx::g_al_api_impl.alGetBoolean(param);
 }
 
 AL_API ALint AL_APIENTRY alGetInteger(
 	ALenum param)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetInteger};
+
 	return eaxefx::g_al_api_impl.alGetInteger(param);
 }
 
 AL_API ALfloat AL_APIENTRY alGetFloat(
 	ALenum param)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetFloat};
+
 	return eaxefx::g_al_api_impl.alGetFloat(param);
 }
 
 AL_API ALdouble AL_APIENTRY alGetDouble(
 	ALenum param)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetDouble};
+
 	return eaxefx::g_al_api_impl.alGetDouble(param);
 }
 
 AL_API ALenum AL_APIENTRY alGetError()
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetError};
+
 	return eaxefx::g_al_api_impl.alGetError();
 }
 
 AL_API ALboolean AL_APIENTRY alIsExtensionPresent(
 	const ALchar* extname)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alIsExtensionPresent};
+
 	return eaxefx::g_al_api_impl.alIsExtensionPresent(extname);
 }
 
 AL_API void* AL_APIENTRY alGetProcAddress(
 	const ALchar* fname)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetProcAddress};
+
 	return eaxefx::g_al_api_impl.alGetProcAddress(fname);
 }
 
 AL_API ALenum AL_APIENTRY alGetEnumValue(
 	const ALchar* ename)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetEnumValue};
+
 	return eaxefx::g_al_api_impl.alGetEnumValue(ename);
 }
 
@@ -3583,6 +4007,8 @@ AL_API void AL_APIENTRY alListenerf(
 	ALenum param,
 	ALfloat value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alListenerf};
+
 	eaxefx::g_al_api_impl.alListenerf(param, value);
 }
 
@@ -3592,6 +4018,8 @@ AL_API void AL_APIENTRY alListener3f(
 	ALfloat value2,
 	ALfloat value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alListener3f};
+
 	eaxefx::g_al_api_impl.alListener3f(param, value1, value2, value3);
 }
 
@@ -3599,6 +4027,8 @@ AL_API void AL_APIENTRY alListenerfv(
 	ALenum param,
 	const ALfloat* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alListenerfv};
+
 	eaxefx::g_al_api_impl.alListenerfv(param, values);
 }
 
@@ -3606,6 +4036,8 @@ AL_API void AL_APIENTRY alListeneri(
 	ALenum param,
 	ALint value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alListeneri};
+
 	eaxefx::g_al_api_impl.alListeneri(param, value);
 }
 
@@ -3615,6 +4047,8 @@ AL_API void AL_APIENTRY alListener3i(
 	ALint value2,
 	ALint value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alListener3i};
+
 	eaxefx::g_al_api_impl.alListener3i(param, value1, value2, value3);
 }
 
@@ -3622,6 +4056,8 @@ AL_API void AL_APIENTRY alListeneriv(
 	ALenum param,
 	const ALint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alListeneriv};
+
 	eaxefx::g_al_api_impl.alListeneriv(param, values);
 }
 
@@ -3629,6 +4065,8 @@ AL_API void AL_APIENTRY alGetListenerf(
 	ALenum param,
 	ALfloat* value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetListenerf};
+
 	eaxefx::g_al_api_impl.alGetListenerf(param, value);
 }
 
@@ -3638,6 +4076,8 @@ AL_API void AL_APIENTRY alGetListener3f(
 	ALfloat* value2,
 	ALfloat* value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetListener3f};
+
 	eaxefx::g_al_api_impl.alGetListener3f(param, value1, value2, value3);
 }
 
@@ -3645,6 +4085,8 @@ AL_API void AL_APIENTRY alGetListenerfv(
 	ALenum param,
 	ALfloat* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetListenerfv};
+
 	eaxefx::g_al_api_impl.alGetListenerfv(param, values);
 }
 
@@ -3652,6 +4094,8 @@ AL_API void AL_APIENTRY alGetListeneri(
 	ALenum param,
 	ALint* value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetListeneri};
+
 	eaxefx::g_al_api_impl.alGetListeneri(param, value);
 }
 
@@ -3661,6 +4105,8 @@ AL_API void AL_APIENTRY alGetListener3i(
 	ALint* value2,
 	ALint* value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetListener3i};
+
 	eaxefx::g_al_api_impl.alGetListener3i(param, value1, value2, value3);
 }
 
@@ -3668,6 +4114,8 @@ AL_API void AL_APIENTRY alGetListeneriv(
 	ALenum param,
 	ALint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetListeneriv};
+
 	eaxefx::g_al_api_impl.alGetListeneriv(param, values);
 }
 
@@ -3675,6 +4123,8 @@ AL_API void AL_APIENTRY alGenSources(
 	ALsizei n,
 	ALuint* sources)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGenSources};
+
 	eaxefx::g_al_api_impl.alGenSources(n, sources);
 }
 
@@ -3682,12 +4132,16 @@ AL_API void AL_APIENTRY alDeleteSources(
 	ALsizei n,
 	const ALuint* sources)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alDeleteSources};
+
 	eaxefx::g_al_api_impl.alDeleteSources(n, sources);
 }
 
 AL_API ALboolean AL_APIENTRY alIsSource(
 	ALuint source)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alIsSource};
+
 	return eaxefx::g_al_api_impl.alIsSource(source);
 }
 
@@ -3696,6 +4150,8 @@ AL_API void AL_APIENTRY alSourcef(
 	ALenum param,
 	ALfloat value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourcef};
+
 	eaxefx::g_al_api_impl.alSourcef(source, param, value);
 }
 
@@ -3706,6 +4162,8 @@ AL_API void AL_APIENTRY alSource3f(
 	ALfloat value2,
 	ALfloat value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSource3f};
+
 	eaxefx::g_al_api_impl.alSource3f(source, param, value1, value2, value3);
 }
 
@@ -3714,6 +4172,8 @@ AL_API void AL_APIENTRY alSourcefv(
 	ALenum param,
 	const ALfloat* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourcefv};
+
 	eaxefx::g_al_api_impl.alSourcefv(source, param, values);
 }
 
@@ -3722,6 +4182,8 @@ AL_API void AL_APIENTRY alSourcei(
 	ALenum param,
 	ALint value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourcei};
+
 	eaxefx::g_al_api_impl.alSourcei(source, param, value);
 }
 
@@ -3732,6 +4194,8 @@ AL_API void AL_APIENTRY alSource3i(
 	ALint value2,
 	ALint value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSource3i};
+
 	eaxefx::g_al_api_impl.alSource3i(source, param, value1, value2, value3);
 }
 
@@ -3740,6 +4204,8 @@ AL_API void AL_APIENTRY alSourceiv(
 	ALenum param,
 	const ALint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourceiv};
+
 	eaxefx::g_al_api_impl.alSourceiv(source, param, values);
 }
 
@@ -3748,6 +4214,8 @@ AL_API void AL_APIENTRY alGetSourcef(
 	ALenum param,
 	ALfloat* value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetSourcef};
+
 	eaxefx::g_al_api_impl.alGetSourcef(source, param, value);
 }
 
@@ -3758,6 +4226,8 @@ AL_API void AL_APIENTRY alGetSource3f(
 	ALfloat* value2,
 	ALfloat* value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetSource3f};
+
 	eaxefx::g_al_api_impl.alGetSource3f(source, param, value1, value2, value3);
 }
 
@@ -3766,6 +4236,8 @@ AL_API void AL_APIENTRY alGetSourcefv(
 	ALenum param,
 	ALfloat* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetSourcefv};
+
 	eaxefx::g_al_api_impl.alGetSourcefv(source, param, values);
 }
 
@@ -3774,6 +4246,8 @@ AL_API void AL_APIENTRY alGetSourcei(
 	ALenum param,
 	ALint* value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetSourcei};
+
 	eaxefx::g_al_api_impl.alGetSourcei(source, param, value);
 }
 
@@ -3784,6 +4258,8 @@ AL_API void AL_APIENTRY alGetSource3i(
 	ALint* value2,
 	ALint* value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetSource3i};
+
 	eaxefx::g_al_api_impl.alGetSource3i(source, param, value1, value2, value3);
 }
 
@@ -3792,6 +4268,8 @@ AL_API void AL_APIENTRY alGetSourceiv(
 	ALenum param,
 	ALint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetSourceiv};
+
 	eaxefx::g_al_api_impl.alGetSourceiv(source, param, values);
 }
 
@@ -3799,6 +4277,8 @@ AL_API void AL_APIENTRY alSourcePlayv(
 	ALsizei n,
 	const ALuint* sources)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourcePlayv};
+
 	eaxefx::g_al_api_impl.alSourcePlayv(n, sources);
 }
 
@@ -3806,6 +4286,8 @@ AL_API void AL_APIENTRY alSourceStopv(
 	ALsizei n,
 	const ALuint* sources)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourceStopv};
+
 	eaxefx::g_al_api_impl.alSourceStopv(n, sources);
 }
 
@@ -3813,6 +4295,8 @@ AL_API void AL_APIENTRY alSourceRewindv(
 	ALsizei n,
 	const ALuint* sources)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourceRewindv};
+
 	eaxefx::g_al_api_impl.alSourceRewindv(n, sources);
 }
 
@@ -3820,30 +4304,40 @@ AL_API void AL_APIENTRY alSourcePausev(
 	ALsizei n,
 	const ALuint* sources)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourcePausev};
+
 	eaxefx::g_al_api_impl.alSourcePausev(n, sources);
 }
 
 AL_API void AL_APIENTRY alSourcePlay(
 	ALuint source)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourcePlay};
+
 	eaxefx::g_al_api_impl.alSourcePlay(source);
 }
 
 AL_API void AL_APIENTRY alSourceStop(
 	ALuint source)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourceStop};
+
 	eaxefx::g_al_api_impl.alSourceStop(source);
 }
 
 AL_API void AL_APIENTRY alSourceRewind(
 	ALuint source)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourceRewind};
+
 	eaxefx::g_al_api_impl.alSourceRewind(source);
 }
 
 AL_API void AL_APIENTRY alSourcePause(
 	ALuint source)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourcePause};
+
 	eaxefx::g_al_api_impl.alSourcePause(source);
 }
 
@@ -3852,6 +4346,8 @@ AL_API void AL_APIENTRY alSourceQueueBuffers(
 	ALsizei nb,
 	const ALuint* buffers)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourceQueueBuffers};
+
 	eaxefx::g_al_api_impl.alSourceQueueBuffers(source, nb, buffers);
 }
 
@@ -3860,6 +4356,8 @@ AL_API void AL_APIENTRY alSourceUnqueueBuffers(
 	ALsizei nb,
 	ALuint* buffers)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alSourceUnqueueBuffers};
+
 	eaxefx::g_al_api_impl.alSourceUnqueueBuffers(source, nb, buffers);
 }
 
@@ -3867,6 +4365,8 @@ AL_API void AL_APIENTRY alGenBuffers(
 	ALsizei n,
 	ALuint* buffers)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGenBuffers};
+
 	eaxefx::g_al_api_impl.alGenBuffers(n, buffers);
 }
 
@@ -3874,12 +4374,16 @@ AL_API void AL_APIENTRY alDeleteBuffers(
 	ALsizei n,
 	const ALuint* buffers)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alDeleteBuffers};
+
 	eaxefx::g_al_api_impl.alDeleteBuffers(n, buffers);
 }
 
 AL_API ALboolean AL_APIENTRY alIsBuffer(
 	ALuint buffer)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alIsBuffer};
+
 	return eaxefx::g_al_api_impl.alIsBuffer(buffer);
 }
 
@@ -3890,6 +4394,8 @@ AL_API void AL_APIENTRY alBufferData(
 	ALsizei size,
 	ALsizei freq)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alBufferData};
+
 	eaxefx::g_al_api_impl.alBufferData(buffer, format, data, size, freq);
 }
 
@@ -3898,6 +4404,8 @@ AL_API void AL_APIENTRY alBufferf(
 	ALenum param,
 	ALfloat value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alBufferf};
+
 	eaxefx::g_al_api_impl.alBufferf(buffer, param, value);
 }
 
@@ -3908,6 +4416,8 @@ AL_API void AL_APIENTRY alBuffer3f(
 	ALfloat value2,
 	ALfloat value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alBuffer3f};
+
 	eaxefx::g_al_api_impl.alBuffer3f(buffer, param, value1, value2, value3);
 }
 
@@ -3916,6 +4426,8 @@ AL_API void AL_APIENTRY alBufferfv(
 	ALenum param,
 	const ALfloat* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alBufferfv};
+
 	eaxefx::g_al_api_impl.alBufferfv(buffer, param, values);
 }
 
@@ -3924,6 +4436,8 @@ AL_API void AL_APIENTRY alBufferi(
 	ALenum param,
 	ALint value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alBufferi};
+
 	eaxefx::g_al_api_impl.alBufferi(buffer, param, value);
 }
 
@@ -3934,6 +4448,8 @@ AL_API void AL_APIENTRY alBuffer3i(
 	ALint value2,
 	ALint value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alBuffer3i};
+
 	eaxefx::g_al_api_impl.alBuffer3i(buffer, param, value1, value2, value3);
 }
 
@@ -3942,6 +4458,8 @@ AL_API void AL_APIENTRY alBufferiv(
 	ALenum param,
 	const ALint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alBufferiv};
+
 	eaxefx::g_al_api_impl.alBufferiv(buffer, param, values);
 }
 
@@ -3950,6 +4468,8 @@ AL_API void AL_APIENTRY alGetBufferf(
 	ALenum param,
 	ALfloat* value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBufferf};
+
 	eaxefx::g_al_api_impl.alGetBufferf(buffer, param, value);
 }
 
@@ -3960,6 +4480,8 @@ AL_API void AL_APIENTRY alGetBuffer3f(
 	ALfloat* value2,
 	ALfloat* value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBuffer3f};
+
 	eaxefx::g_al_api_impl.alGetBuffer3f(buffer, param, value1, value2, value3);
 }
 
@@ -3968,6 +4490,8 @@ AL_API void AL_APIENTRY alGetBufferfv(
 	ALenum param,
 	ALfloat* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBufferfv};
+
 	eaxefx::g_al_api_impl.alGetBufferfv(buffer, param, values);
 }
 
@@ -3976,6 +4500,8 @@ AL_API void AL_APIENTRY alGetBufferi(
 	ALenum param,
 	ALint* value)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBufferi};
+
 	eaxefx::g_al_api_impl.alGetBufferi(buffer, param, value);
 }
 
@@ -3986,6 +4512,8 @@ AL_API void AL_APIENTRY alGetBuffer3i(
 	ALint* value2,
 	ALint* value3)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBuffer3i};
+
 	eaxefx::g_al_api_impl.alGetBuffer3i(buffer, param, value1, value2, value3);
 }
 
@@ -3994,6 +4522,8 @@ AL_API void AL_APIENTRY alGetBufferiv(
 	ALenum param,
 	ALint* values)
 {
+	const auto stats_scope = eaxefx::AlApiStatsScope{eaxefx::AlAlSymbolsNames::alGetBufferiv};
+
 	eaxefx::g_al_api_impl.alGetBufferiv(buffer, param, values);
 }
 
@@ -40,9 +40,11 @@ OR OTHER DEALINGS IN THE SOFTWARE.
 #include "AL/alc.h"
 
 #include "eaxefx_al_api.h"
+#include "eaxefx_al_api_stats.h"
 #include "eaxefx_al_api_utils.h"
 #include "eaxefx_eax_api.h"
 #include "eaxefx_exception.h"
+#include "eaxefx_mutex_profiler.h"
 #include "eaxefx_string.h"
 #include "eaxefx_utils.h"
 
@@ -85,6 +87,9 @@ public:
 
 	void alc_make_current() override;
 
+	void alc_make_thread_current(
+		PFNALCSETTHREADCONTEXTPROC alc_set_thread_context) override;
+
 	void alc_destroy() override;
 
 	void* al_get_proc_address(
@@ -107,6 +112,8 @@ public:
 
 	Eaxx& get_eaxx() override;
 
+	MoveableMutexLock get_lock() override;
+
 
 private:
 	static constexpr auto min_attribute_capacity = 128;
@@ -120,6 +127,8 @@ private:
 	using Attributes = std::vector<ALCint>;
 
 
+	MutexUPtr mutex_{};
+
 	ALCdevice* al_device_{};
 
 	Logger* logger_{};
@@ -183,6 +192,8 @@ private:
 	void make_efx_symbol_map();
 
 	void make_eaxx();
+
+	void initialize_on_first_make_current();
 }; // AlApiContextImpl
 
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -192,6 +203,9 @@ private:
 
 AlApiContextImpl::AlApiContextImpl()
 {
+	//
+	mutex_ = g_mutex_profiler.make_mutex("AL context");
+
 	//
 	logger_ = g_al_api.get_logger();
 
@@ -220,6 +234,8 @@ AlApiContextImpl::AlApiContextImpl()
 AlApiContextImpl::AlApiContextImpl(
 	AlApiContextImpl&& rhs) noexcept
 {
+	std::swap(mutex_, rhs.mutex_);
+
 	std::swap(al_device_, rhs.al_device_);
 
 	std::swap(logger_, rhs.logger_);
@@ -279,44 +295,22 @@ void AlApiContextImpl::alc_make_current()
 		fail("AL failed to make a context current.");
 	}
 
-	if (is_made_current_)
-	{
-		return;
-	}
-
-	is_made_current_ = true;
+	initialize_on_first_make_current();
+}
 
-	try
-	{
-		get_attributes();
-		get_efx_attributes();
-		log_context_info();
-	}
-	catch (...)
-	{
-		utils::log_exception(logger_);
-	}
+void AlApiContextImpl::alc_make_thread_current(
+	PFNALCSETTHREADCONTEXTPROC alc_set_thread_context)
+{
+	assert(alc_set_thread_context);
 
-	try
-	{
-		make_efx_symbols();
-		make_efx_symbol_map();
+	const auto al_is_made_current = (alc_set_thread_context(al_context_) != ALC_FALSE);
 
-		make_eaxx();
-	}
-	catch (...)
+	if (!al_is_made_current)
 	{
-		utils::log_exception(logger_);
+		fail("AL failed to make a context current for the thread.");
 	}
 
-	try
-	{
-		make_extensions();
-	}
-	catch (...)
-	{
-		utils::log_exception(logger_);
-	}
+	initialize_on_first_make_current();
 }
 
 void AlApiContextImpl::alc_destroy()
@@ -447,6 +441,14 @@ Eaxx& AlApiContextImpl::get_eaxx()
 	return *eaxx_;
 }
 
+MoveableMutexLock AlApiContextImpl::get_lock()
+{
+	assert(mutex_);
+
+	const auto lock_wait_scope = AlApiStatsLockWaitScope{};
+	return MoveableMutexLock{*mutex_};
+}
+
 [[noreturn]]
 void AlApiContextImpl::fail(
 	const char* message)
@@ -721,6 +723,8 @@ void AlApiContextImpl::make_efx_symbols()
 	}
 
 	al_efx_symbols_ = al_loader->resolve_efx_symbols();
+
+	g_al_api_stats.instrument(*al_efx_symbols_);
 }
 
 void AlApiContextImpl::make_efx_symbol_map()
@@ -772,6 +776,48 @@ void AlApiContextImpl::make_eaxx()
 	eaxx_ = eaxefx::make_eaxx(create_param);
 }
 
+void AlApiContextImpl::initialize_on_first_make_current()
+{
+	if (is_made_current_)
+	{
+		return;
+	}
+
+	is_made_current_ = true;
+
+	try
+	{
+		get_attributes();
+		get_efx_attributes();
+		log_context_info();
+	}
+	catch (...)
+	{
+		utils::log_exception(logger_);
+	}
+
+	try
+	{
+		make_efx_symbols();
+		make_efx_symbol_map();
+
+		make_eaxx();
+	}
+	catch (...)
+	{
+		utils::log_exception(logger_);
+	}
+
+	try
+	{
+		make_extensions();
+	}
+	catch (...)
+	{
+		utils::log_exception(logger_);
+	}
+}
+
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 
 
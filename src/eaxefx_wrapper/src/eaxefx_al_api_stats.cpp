@@ -0,0 +1,700 @@
+/*
+
+EAX OpenAL Extension
+
+Copyright (c) 2020-2021 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+
+#include "eaxefx_al_api_stats.h"
+
+#include <algorithm>
+#include <string_view>
+
+#include "eaxefx_env.h"
+#include "eaxefx_string.h"
+
+
+namespace eaxefx
+{
+
+
+namespace
+{
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+constexpr auto al_api_stats_env_name = "EAXEFX_STATS";
+
+
+std::uint64_t al_api_stats_to_ns(
+	AlApiStatsClock::duration duration) noexcept
+{
+	const auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+
+	return duration_ns > 0 ? static_cast<std::uint64_t>(duration_ns) : 0;
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+template<
+	typename TMember
+>
+struct AlApiStatsMemberTraits;
+
+template<
+	typename TSymbols,
+	typename TFunc
+>
+struct AlApiStatsMemberTraits<TFunc TSymbols::*>
+{
+	using Func = TFunc;
+}; // AlApiStatsMemberTraits
+
+
+template<
+	typename TFunc
+>
+struct AlApiStatsFuncTraits;
+
+template<
+	typename TResult,
+	typename... TArgs
+>
+struct AlApiStatsFuncTraits<TResult (AL_APIENTRY*)(TArgs...)>
+{
+	template<
+		typename TSymbol
+	>
+	static TResult AL_APIENTRY thunk(
+		TArgs... args)
+	{
+		const auto driver_scope = AlApiStatsDriverScope{};
+
+		return TSymbol::driver_func(args...);
+	}
+}; // AlApiStatsFuncTraits
+
+
+template<
+	auto TMember
+>
+struct AlApiStatsSymbol
+{
+	using Func = typename AlApiStatsMemberTraits<decltype(TMember)>::Func;
+
+	static inline Func driver_func{};
+}; // AlApiStatsSymbol
+
+
+template<
+	auto TMember,
+	typename TSymbols
+>
+void instrument_symbol(
+	TSymbols& symbols) noexcept
+{
+	using Symbol = AlApiStatsSymbol<TMember>;
+	using FuncTraits = AlApiStatsFuncTraits<typename Symbol::Func>;
+
+	const auto thunk = &FuncTraits::template thunk<Symbol>;
+
+	auto& func = symbols.*TMember;
+
+	if (!func || func == thunk)
+	{
+		return;
+	}
+
+	// There is only one slot for the original function per symbol.
+	// Leave the symbol as is if the driver returned different function for it.
+	//
+	if (Symbol::driver_func && Symbol::driver_func != func)
+	{
+		return;
+	}
+
+	Symbol::driver_func = func;
+	func = thunk;
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+} // namespace
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+void AlApiStatsHistogram::add(
+	std::uint64_t duration_ns) noexcept
+{
+	count_.fetch_add(1, std::memory_order_relaxed);
+	total_ns_.fetch_add(duration_ns, std::memory_order_relaxed);
+
+	auto max_ns = max_ns_.load(std::memory_order_relaxed);
+
+	while (duration_ns > max_ns &&
+		!max_ns_.compare_exchange_weak(max_ns, duration_ns, std::memory_order_relaxed))
+	{
+	}
+
+	buckets_[get_bucket_index(duration_ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+AlApiStatsHistogramSnapshot AlApiStatsHistogram::make_snapshot() const noexcept
+{
+	auto snapshot = AlApiStatsHistogramSnapshot{};
+
+	snapshot.count = count_.load(std::memory_order_relaxed);
+	snapshot.total_ns = total_ns_.load(std::memory_order_relaxed);
+	snapshot.max_ns = max_ns_.load(std::memory_order_relaxed);
+
+	for (auto i = 0; i < al_api_stats_bucket_count; ++i)
+	{
+		snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+	}
+
+	return snapshot;
+}
+
+void AlApiStatsHistogram::reset() noexcept
+{
+	count_.store(0, std::memory_order_relaxed);
+	total_ns_.store(0, std::memory_order_relaxed);
+	max_ns_.store(0, std::memory_order_relaxed);
+
+	for (auto& bucket : buckets_)
+	{
+		bucket.store(0, std::memory_order_relaxed);
+	}
+}
+
+int AlApiStatsHistogram::get_bucket_index(
+	std::uint64_t duration_ns) noexcept
+{
+	auto index = 0;
+
+	while (duration_ns != 0 && index < (al_api_stats_bucket_count - 1))
+	{
+		duration_ns >>= 1;
+		index += 1;
+	}
+
+	return index;
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+void AlApiStats::initialize(
+	Logger* logger) noexcept
+try
+{
+	logger_ = logger;
+
+	const auto env_value = env::get_variable(al_api_stats_env_name);
+	const auto is_enabled = (std::string_view{env_value.c_str()} == "1");
+
+	is_enabled_.store(is_enabled, std::memory_order_relaxed);
+
+	if (is_enabled && logger_)
+	{
+		logger_->info("Statistics enabled.");
+	}
+}
+catch (...)
+{
+	is_enabled_.store(false, std::memory_order_relaxed);
+}
+
+bool AlApiStats::is_enabled() const noexcept
+{
+	return is_enabled_.load(std::memory_order_relaxed);
+}
+
+AlApiStatsEntry* AlApiStats::find_or_add_entry(
+	const char* symbol_name) noexcept
+{
+	if (!symbol_name)
+	{
+		return nullptr;
+	}
+
+	const auto hash = (reinterpret_cast<std::uintptr_t>(symbol_name) >> 2) * std::uintptr_t{2'654'435'761U};
+	auto index = static_cast<int>(hash % max_entries);
+
+	for (auto i = 0; i < max_entries; ++i)
+	{
+		auto& entry = entries_[index];
+		auto entry_symbol_name = entry.symbol_name.load(std::memory_order_acquire);
+
+		if (!entry_symbol_name)
+		{
+			if (entry.symbol_name.compare_exchange_strong(
+				entry_symbol_name,
+				symbol_name,
+				std::memory_order_acq_rel))
+			{
+				return &entry;
+			}
+		}
+
+		if (entry_symbol_name == symbol_name)
+		{
+			return &entry;
+		}
+
+		index = (index + 1) % max_entries;
+	}
+
+	return nullptr;
+}
+
+AlApiStatsSnapshot AlApiStats::make_snapshot() const
+{
+	auto snapshot = AlApiStatsSnapshot{};
+	snapshot.reserve(max_entries);
+
+	for (const auto& entry : entries_)
+	{
+		const auto symbol_name = entry.symbol_name.load(std::memory_order_acquire);
+
+		if (!symbol_name)
+		{
+			continue;
+		}
+
+		auto entry_snapshot = AlApiStatsEntrySnapshot{};
+		entry_snapshot.symbol_name = symbol_name;
+		entry_snapshot.call_count = entry.call_count.load(std::memory_order_relaxed);
+		entry_snapshot.wrapper_time = entry.wrapper_time.make_snapshot();
+		entry_snapshot.driver_time = entry.driver_time.make_snapshot();
+		entry_snapshot.lock_wait_time = entry.lock_wait_time.make_snapshot();
+
+		if (entry_snapshot.call_count == 0)
+		{
+			continue;
+		}
+
+		snapshot.emplace_back(entry_snapshot);
+	}
+
+	std::sort(
+		snapshot.begin(),
+		snapshot.end(),
+		[](
+			const AlApiStatsEntrySnapshot& lhs,
+			const AlApiStatsEntrySnapshot& rhs)
+		{
+			const auto lhs_total_ns = lhs.wrapper_time.total_ns + lhs.driver_time.total_ns + lhs.lock_wait_time.total_ns;
+			const auto rhs_total_ns = rhs.wrapper_time.total_ns + rhs.driver_time.total_ns + rhs.lock_wait_time.total_ns;
+
+			return lhs_total_ns > rhs_total_ns;
+		}
+	);
+
+	return snapshot;
+}
+
+void AlApiStats::reset() noexcept
+{
+	for (auto& entry : entries_)
+	{
+		entry.call_count.store(0, std::memory_order_relaxed);
+		entry.wrapper_time.reset();
+		entry.driver_time.reset();
+		entry.lock_wait_time.reset();
+	}
+}
+
+void AlApiStats::log() noexcept
+try
+{
+	if (!is_enabled() || !logger_)
+	{
+		return;
+	}
+
+	const auto snapshot = make_snapshot();
+
+	logger_->info("");
+	logger_->info("Statistics (time in nanoseconds; bucket \"<N\" counts calls faster than N):");
+
+	auto string = String{};
+
+	const auto log_histogram = [this, &string](
+		const char* title,
+		const AlApiStatsHistogramSnapshot& histogram)
+	{
+		if (histogram.count == 0)
+		{
+			return;
+		}
+
+		string.clear();
+		string += "    ";
+		string += title;
+		string += ": count ";
+		string += to_string(static_cast<unsigned long long>(histogram.count));
+		string += ", avg ";
+		string += to_string(static_cast<unsigned long long>(histogram.total_ns / histogram.count));
+		string += ", max ";
+		string += to_string(static_cast<unsigned long long>(histogram.max_ns));
+		string += ";";
+
+		for (auto i = 0; i < al_api_stats_bucket_count; ++i)
+		{
+			const auto bucket_count = histogram.buckets[i];
+
+			if (bucket_count == 0)
+			{
+				continue;
+			}
+
+			string += ' ';
+
+			if (i < (al_api_stats_bucket_count - 1))
+			{
+				string += '<';
+				string += to_string(1ULL << i);
+			}
+			else
+			{
+				string += ">=";
+				string += to_string(1ULL << (i - 1));
+			}
+
+			string += ':';
+			string += to_string(static_cast<unsigned long long>(bucket_count));
+		}
+
+		logger_->info(string.c_str());
+	};
+
+	for (const auto& entry : snapshot)
+	{
+		string.clear();
+		string += "  ";
+		string += entry.symbol_name;
+		string += ": calls ";
+		string += to_string(static_cast<unsigned long long>(entry.call_count));
+		logger_->info(string.c_str());
+
+		log_histogram("wrapper", entry.wrapper_time);
+		log_histogram("driver", entry.driver_time);
+		log_histogram("lock wait", entry.lock_wait_time);
+	}
+}
+catch (...)
+{
+}
+
+void AlApiStats::instrument(
+	AlAlcSymbols& al_alc_symbols) noexcept
+{
+	if (!is_enabled())
+	{
+		return;
+	}
+
+	instrument_symbol<&AlAlcSymbols::alcCreateContext>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcMakeContextCurrent>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcProcessContext>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcSuspendContext>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcDestroyContext>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcGetCurrentContext>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcGetContextsDevice>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcOpenDevice>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcCloseDevice>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcGetError>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcIsExtensionPresent>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcGetProcAddress>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcGetEnumValue>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcGetString>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcGetIntegerv>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcCaptureOpenDevice>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcCaptureCloseDevice>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcCaptureStart>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcCaptureStop>(al_alc_symbols);
+	instrument_symbol<&AlAlcSymbols::alcCaptureSamples>(al_alc_symbols);
+}
+
+void AlApiStats::instrument(
+	AlAlSymbols& al_al_symbols) noexcept
+{
+	if (!is_enabled())
+	{
+		return;
+	}
+
+	instrument_symbol<&AlAlSymbols::alDopplerFactor>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alDopplerVelocity>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSpeedOfSound>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alDistanceModel>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alEnable>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alDisable>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alIsEnabled>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetString>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBooleanv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetIntegerv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetFloatv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetDoublev>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBoolean>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetInteger>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetFloat>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetDouble>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetError>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alIsExtensionPresent>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetProcAddress>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetEnumValue>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alListenerf>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alListener3f>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alListenerfv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alListeneri>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alListener3i>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alListeneriv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetListenerf>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetListener3f>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetListenerfv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetListeneri>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetListener3i>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetListeneriv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGenSources>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alDeleteSources>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alIsSource>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourcef>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSource3f>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourcefv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourcei>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSource3i>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourceiv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetSourcef>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetSource3f>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetSourcefv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetSourcei>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetSource3i>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetSourceiv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourcePlayv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourceStopv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourceRewindv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourcePausev>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourcePlay>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourceStop>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourceRewind>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourcePause>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourceQueueBuffers>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alSourceUnqueueBuffers>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGenBuffers>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alDeleteBuffers>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alIsBuffer>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alBufferData>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alBufferf>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alBuffer3f>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alBufferfv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alBufferi>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alBuffer3i>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alBufferiv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBufferf>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBuffer3f>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBufferfv>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBufferi>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBuffer3i>(al_al_symbols);
+	instrument_symbol<&AlAlSymbols::alGetBufferiv>(al_al_symbols);
+}
+
+void AlApiStats::instrument(
+	AlEfxSymbols& al_efx_symbols) noexcept
+{
+	if (!is_enabled())
+	{
+		return;
+	}
+
+	instrument_symbol<&AlEfxSymbols::alGenEffects>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alDeleteEffects>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alIsEffect>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alEffecti>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alEffectiv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alEffectf>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alEffectfv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetEffecti>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetEffectiv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetEffectf>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetEffectfv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGenFilters>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alDeleteFilters>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alIsFilter>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alFilteri>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alFilteriv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alFilterf>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alFilterfv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetFilteri>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetFilteriv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetFilterf>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetFilterfv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGenAuxiliaryEffectSlots>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alDeleteAuxiliaryEffectSlots>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alIsAuxiliaryEffectSlot>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alAuxiliaryEffectSloti>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alAuxiliaryEffectSlotiv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alAuxiliaryEffectSlotf>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alAuxiliaryEffectSlotfv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetAuxiliaryEffectSloti>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetAuxiliaryEffectSlotiv>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetAuxiliaryEffectSlotf>(al_efx_symbols);
+	instrument_symbol<&AlEfxSymbols::alGetAuxiliaryEffectSlotfv>(al_efx_symbols);
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+thread_local AlApiStatsScope* AlApiStatsScope::current_{};
+
+
+AlApiStatsScope::AlApiStatsScope(
+	const char* symbol_name) noexcept
+	:
+	mutex_profiler_scope_{symbol_name}
+{
+	if (!g_al_api_stats.is_enabled())
+	{
+		return;
+	}
+
+	entry_ = g_al_api_stats.find_or_add_entry(symbol_name);
+
+	if (!entry_)
+	{
+		return;
+	}
+
+	previous_ = current_;
+	current_ = this;
+
+	begin_time_ = AlApiStatsClock::now();
+}
+
+AlApiStatsScope::~AlApiStatsScope()
+{
+	if (!entry_)
+	{
+		return;
+	}
+
+	const auto end_time = AlApiStatsClock::now();
+
+	current_ = previous_;
+
+	const auto total_ns = al_api_stats_to_ns(end_time - begin_time_);
+	const auto other_ns = driver_ns_ + lock_wait_ns_;
+	const auto wrapper_ns = (total_ns > other_ns ? total_ns - other_ns : 0);
+
+	entry_->call_count.fetch_add(1, std::memory_order_relaxed);
+	entry_->wrapper_time.add(wrapper_ns);
+
+	if (has_driver_calls_)
+	{
+		entry_->driver_time.add(driver_ns_);
+	}
+
+	if (has_lock_waits_)
+	{
+		entry_->lock_wait_time.add(lock_wait_ns_);
+	}
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+AlApiStatsDriverScope::AlApiStatsDriverScope() noexcept
+	:
+	scope_{AlApiStatsScope::current_}
+{
+	if (!scope_)
+	{
+		return;
+	}
+
+	begin_time_ = AlApiStatsClock::now();
+}
+
+AlApiStatsDriverScope::~AlApiStatsDriverScope()
+{
+	if (!scope_)
+	{
+		return;
+	}
+
+	scope_->has_driver_calls_ = true;
+	scope_->driver_ns_ += al_api_stats_to_ns(AlApiStatsClock::now() - begin_time_);
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+AlApiStatsLockWaitScope::AlApiStatsLockWaitScope() noexcept
+	:
+	scope_{AlApiStatsScope::current_}
+{
+	if (!scope_)
+	{
+		return;
+	}
+
+	begin_time_ = AlApiStatsClock::now();
+}
+
+AlApiStatsLockWaitScope::~AlApiStatsLockWaitScope()
+{
+	if (!scope_)
+	{
+		return;
+	}
+
+	scope_->has_lock_waits_ = true;
+	scope_->lock_wait_ns_ += al_api_stats_to_ns(AlApiStatsClock::now() - begin_time_);
+}
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+AlApiStats g_al_api_stats{};
+
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+
+} // eaxefx
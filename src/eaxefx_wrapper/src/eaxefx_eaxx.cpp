@@ -50,6 +50,7 @@ OR OTHER DEALINGS IN THE SOFTWARE.
 #include "eaxefx_utils.h"
 
 #include "eaxefx_al_api.h"
+#include "eaxefx_al_api_stats.h"
 #include "eaxefx_al_api_utils.h"
 #include "eaxefx_al_low_pass_param.h"
 #include "eaxefx_al_object.h"
@@ -83,9 +84,10 @@ ALenum AL_APIENTRY EAXSet(
 	ALuint property_size)
 try
 {
-	const auto mutex_lock = g_al_api.get_lock();
-	auto& al_api_context = g_al_api.get_current_context();
-	auto& eaxx = al_api_context.get_eaxx();
+	const auto stats_scope = AlApiStatsScope{AlEaxSymbolsNames::EAXSet};
+
+	const auto locked_context = g_al_api.lock_current_context();
+	auto& eaxx = locked_context.context->get_eaxx();
 
 	try
 	{
@@ -117,9 +119,10 @@ ALenum AL_APIENTRY EAXGet(
 	ALuint property_size)
 try
 {
-	const auto mutex_lock = g_al_api.get_lock();
-	auto& al_api_context = g_al_api.get_current_context();
-	auto& eaxx = al_api_context.get_eaxx();
+	const auto stats_scope = AlApiStatsScope{AlEaxSymbolsNames::EAXGet};
+
+	const auto locked_context = g_al_api.lock_current_context();
+	auto& eaxx = locked_context.context->get_eaxx();
 
 	try
 	{